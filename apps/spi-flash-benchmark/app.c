@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "watch.h"
+#include "spiflash.h"
+
+// Measures read, program and erase throughput of the sensor board's SPI flash, and prints the results over USB.
+// WARNING: this erases the last BENCHMARK_SIZE bytes of the flash.
+
+#define BENCHMARK_SIZE (64 * 1024)
+#define SECTOR_SIZE 4096
+
+static uint8_t buf[SECTOR_SIZE];
+static uint32_t rng_state = 1;
+
+// stands in for whatever work a real caller does to produce a page of data.
+static void fill_page(uint8_t *page) {
+    for (uint16_t i = 0; i < SPI_FLASH_PAGE_SIZE; i++) {
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 17;
+        rng_state ^= rng_state << 5;
+        page[i] = rng_state;
+    }
+}
+
+// the cycle timer wraps after a few seconds, so each step is timed on its own and the results added up.
+static void print_rate(const char *what, uint32_t bytes, uint32_t us) {
+    // no FPU, so thousandths of a MB/s in integer math: bytes per µs is MB/s.
+    uint32_t milli_mbps = us ? (uint32_t)((uint64_t)bytes * 1000 / us) : 0;
+    printf("%-24s %6lu bytes in %8lu us: %lu.%03lu MB/s\r\n", what, (unsigned long)bytes, (unsigned long)us,
+           (unsigned long)(milli_mbps / 1000), (unsigned long)(milli_mbps % 1000));
+}
+
+static uint32_t erase_region(uint32_t start) {
+    uint32_t total = 0;
+    for (uint32_t address = start; address < start + BENCHMARK_SIZE; address += SECTOR_SIZE) {
+        watch_cycle_timer_start();
+        spi_flash_command(CMD_ENABLE_WRITE);
+        spi_flash_sector_command(CMD_SECTOR_ERASE, address);
+        spi_flash_wait_ready();
+        total += watch_cycle_timer_get_us();
+    }
+    return total;
+}
+
+static uint32_t program_region(uint32_t start, bool pipelined) {
+    uint32_t total = 0;
+    rng_state = 1;
+    for (uint32_t address = start; address < start + BENCHMARK_SIZE; address += SECTOR_SIZE) {
+        watch_cycle_timer_start();
+        for (uint32_t page = 0; page < SECTOR_SIZE; page += SPI_FLASH_PAGE_SIZE) {
+            // pipelined, we fill the next page while the chip is programming the last one.
+            fill_page(buf + page);
+            spi_flash_program(address + page, buf + page, SPI_FLASH_PAGE_SIZE);
+            if (!pipelined) spi_flash_wait_ready();
+        }
+        spi_flash_wait_ready();
+        total += watch_cycle_timer_get_us();
+    }
+    return total;
+}
+
+static uint32_t read_region(uint32_t start, bool *ok) {
+    uint32_t total = 0;
+    uint8_t expected[SPI_FLASH_PAGE_SIZE];
+    rng_state = 1;
+    *ok = true;
+    for (uint32_t address = start; address < start + BENCHMARK_SIZE; address += SECTOR_SIZE) {
+        watch_cycle_timer_start();
+        spi_flash_read_data(address, buf, SECTOR_SIZE);
+        total += watch_cycle_timer_get_us();
+        for (uint32_t page = 0; page < SECTOR_SIZE; page += SPI_FLASH_PAGE_SIZE) {
+            fill_page(expected);
+            if (memcmp(expected, buf + page, SPI_FLASH_PAGE_SIZE)) *ok = false;
+        }
+    }
+    return total;
+}
+
+static void run_benchmark(void) {
+    uint8_t jedec_id[3];
+    spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, sizeof(jedec_id));
+    printf("\r\nJEDEC ID %02x %02x %02x\r\n", jedec_id[0], jedec_id[1], jedec_id[2]);
+    if (jedec_id[0] == 0x00 || jedec_id[0] == 0xFF || jedec_id[2] < 17 || jedec_id[2] > 24) {
+        printf("No flash chip found.\r\n");
+        return;
+    }
+    uint32_t start = (1UL << jedec_id[2]) - BENCHMARK_SIZE;
+    bool ok;
+
+    print_rate("sector erase", BENCHMARK_SIZE, erase_region(start));
+    print_rate("page program", BENCHMARK_SIZE, program_region(start, false));
+    print_rate("read", BENCHMARK_SIZE, read_region(start, &ok));
+    if (!ok) printf("Read back didn't match!\r\n");
+
+    erase_region(start);
+    print_rate("pipelined page program", BENCHMARK_SIZE, program_region(start, true));
+    read_region(start, &ok);
+    if (!ok) printf("Read back didn't match!\r\n");
+
+    // every access after an idle period also pays a wake-up from deep power-down.
+    watch_cycle_timer_start();
+    spi_flash_read_data(start, buf, 1);
+    printf("read 1 byte: %lu us\r\n", (unsigned long)watch_cycle_timer_get_us());
+    spi_flash_power_down();
+    watch_cycle_timer_start();
+    spi_flash_read_data(start, buf, 1);
+    printf("read 1 byte after deep power-down: %lu us\r\n", (unsigned long)watch_cycle_timer_get_us());
+    spi_flash_power_down();
+}
+
+void app_init(void) {
+}
+
+void app_wake_from_backup(void) {
+}
+
+void app_setup(void) {
+    spi_flash_init();
+    // give the serial console a chance to connect.
+    delay_ms(5000);
+    run_benchmark();
+}
+
+void app_prepare_for_standby(void) {
+}
+
+void app_wake_from_standby(void) {
+}
+
+bool app_loop(void) {
+    return true;
+}
@@ -168,6 +168,7 @@ SRCS += \
   $(TOP)/watch-library/shared/driver/spiflash.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
+  $(TOP)/watch-library/shared/watch/watch_fixed_math.c \
 
 DEFINES += \
   -D__SAML22J18A__ \
@@ -212,6 +213,7 @@ SRCS += \
   $(TOP)/watch-library/shared/driver/opt3001.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
+  $(TOP)/watch-library/shared/watch/watch_fixed_math.c \
 
 endif
 
@@ -235,6 +237,13 @@ endif
 
 # Build options to customize movement and faces
 
+# EXTERNAL_FLASH=1 puts a second filesystem on the sensor board's SPI flash; see FILESYSTEM_EXTERNAL_PREFIX.
+ifdef EXTERNAL_FLASH
+ifndef EMSCRIPTEN
+CFLAGS += -DFILESYSTEM_EXTERNAL_FLASH
+endif
+endif
+
 ifdef CLOCK_FACE_24H_ONLY
 CFLAGS += -DCLOCK_FACE_24H_ONLY
 endif
\ No newline at end of file
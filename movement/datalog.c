@@ -0,0 +1,318 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "datalog.h"
+
+#define DATALOG_VERSION 1
+#define DATALOG_HEADER_SIZE 8
+// a 32-bit varint takes at most five bytes.
+#define DATALOG_MAX_RECORD_SIZE (5 * (1 + DATALOG_MAX_CHANNELS))
+
+static void _datalog_segment_name(const datalog_t *log, uint8_t segment, char *filename) {
+    sprintf(filename, "%s.%d", log->name, segment);
+}
+
+static uint32_t _datalog_zigzag(int32_t value) {
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t _datalog_unzigzag(uint32_t value) {
+    return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static uint8_t _datalog_write_varint(uint8_t *buf, uint32_t value) {
+    uint8_t length = 0;
+    while (value >= 0x80) {
+        buf[length++] = (value & 0x7F) | 0x80;
+        value >>= 7;
+    }
+    buf[length++] = value;
+
+    return length;
+}
+
+static uint8_t _datalog_encode_record(uint8_t *buf, uint8_t channels, const datalog_record_t *record, const datalog_record_t *previous) {
+    uint8_t length = _datalog_write_varint(buf, _datalog_zigzag((int32_t)(record->timestamp - previous->timestamp)));
+    for (uint8_t i = 0; i < channels; i++) {
+        length += _datalog_write_varint(buf + length, _datalog_zigzag(record->values[i] - previous->values[i]));
+    }
+
+    return length;
+}
+
+static bool _datalog_read_header(const datalog_t *log, uint8_t segment, uint32_t *sequence) {
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+    uint8_t header[DATALOG_HEADER_SIZE];
+
+    _datalog_segment_name(log, segment, filename);
+    filesystem_file_t *file = filesystem_open(filename, FILESYSTEM_MODE_READ);
+    if (file == NULL) return false;
+    bool valid = filesystem_read(file, header, DATALOG_HEADER_SIZE) == DATALOG_HEADER_SIZE &&
+                 header[0] == 'D' && header[1] == 'L' && header[2] == DATALOG_VERSION && header[3] == log->channels;
+    filesystem_close(file);
+
+    if (valid) *sequence = header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+
+    return valid;
+}
+
+static bool _datalog_cursor_read_byte(datalog_cursor_t *cursor, uint8_t *byte) {
+    if (cursor->start == cursor->end) {
+        int32_t bytes_read = filesystem_read(cursor->file, cursor->buf, sizeof(cursor->buf));
+        if (bytes_read <= 0) return false;
+        cursor->start = 0;
+        cursor->end = bytes_read;
+    }
+    *byte = cursor->buf[cursor->start++];
+    cursor->position++;
+
+    return true;
+}
+
+static bool _datalog_cursor_read_varint(datalog_cursor_t *cursor, uint32_t *value) {
+    uint32_t result = 0;
+    for (uint8_t shift = 0; shift < 35; shift += 7) {
+        uint8_t byte;
+        if (!_datalog_cursor_read_byte(cursor, &byte)) return false;
+        result |= (uint32_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) {
+            *value = result;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool _datalog_cursor_decode_record(datalog_cursor_t *cursor) {
+    uint32_t delta;
+    if (!_datalog_cursor_read_varint(cursor, &delta)) return false;
+    cursor->record.timestamp += _datalog_unzigzag(delta);
+    for (uint8_t i = 0; i < cursor->log->channels; i++) {
+        if (!_datalog_cursor_read_varint(cursor, &delta)) return false;
+        cursor->record.values[i] += _datalog_unzigzag(delta);
+    }
+
+    return true;
+}
+
+static bool _datalog_cursor_open_segment(datalog_cursor_t *cursor, uint8_t segment) {
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+
+    _datalog_segment_name(cursor->log, segment, filename);
+    cursor->segment = segment;
+    cursor->position = 0;
+    cursor->start = 0;
+    cursor->end = 0;
+    // each segment's first record is relative to zero.
+    memset(&cursor->record, 0, sizeof(cursor->record));
+    cursor->file = filesystem_open(filename, FILESYSTEM_MODE_READ);
+    if (cursor->file == NULL) return false;
+
+    // the header was checked when the log was opened; skip over it.
+    uint8_t byte;
+    while (cursor->position < DATALOG_HEADER_SIZE) {
+        if (!_datalog_cursor_read_byte(cursor, &byte)) return false;
+    }
+
+    return true;
+}
+
+// counts the records in a segment, and finds the last one and the size of the valid data.
+static uint16_t _datalog_scan_segment(datalog_t *log, uint8_t segment, datalog_record_t *last, uint16_t *size) {
+    datalog_cursor_t cursor;
+    uint16_t count = 0;
+
+    cursor.log = log;
+    if (_datalog_cursor_open_segment(&cursor, segment)) {
+        uint16_t valid_size = cursor.position;
+        while (_datalog_cursor_decode_record(&cursor)) {
+            count++;
+            valid_size = cursor.position;
+            *last = cursor.record;
+        }
+        *size = valid_size;
+    }
+    if (cursor.file != NULL) filesystem_close(cursor.file);
+
+    return count;
+}
+
+bool datalog_open(datalog_t *log, const char *name, uint8_t channels, uint16_t segment_size) {
+    if (strlen(name) > DATALOG_MAX_NAME_LENGTH) return false;
+    if (channels == 0 || channels > DATALOG_MAX_CHANNELS) return false;
+    if (segment_size < DATALOG_HEADER_SIZE + DATALOG_MAX_RECORD_SIZE) return false;
+
+    memset(log, 0, sizeof(datalog_t));
+    strcpy(log->name, name);
+    log->channels = channels;
+    log->segment_size = segment_size;
+
+    uint32_t sequences[2];
+    bool valid[2];
+    valid[0] = _datalog_read_header(log, 0, &sequences[0]);
+    valid[1] = _datalog_read_header(log, 1, &sequences[1]);
+    if (!valid[0] && !valid[1]) return true;
+
+    // the newer segment is the one we append to.
+    log->active = (valid[1] && (!valid[0] || sequences[1] > sequences[0])) ? 1 : 0;
+    log->sequence = sequences[log->active];
+
+    uint8_t older = log->active ^ 1;
+    if (valid[older]) {
+        datalog_record_t unused;
+        uint16_t unused_size;
+        log->counts[older] = _datalog_scan_segment(log, older, &unused, &unused_size);
+    }
+    log->counts[log->active] = _datalog_scan_segment(log, log->active, &log->last, &log->active_size);
+
+    // if there's anything after the last record we could decode, don't append after it: start a new segment.
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+    _datalog_segment_name(log, log->active, filename);
+    if (filesystem_get_file_size(filename) != log->active_size) log->active_size = log->segment_size;
+
+    return true;
+}
+
+bool datalog_append(datalog_t *log, const datalog_record_t *record) {
+    uint8_t buf[DATALOG_HEADER_SIZE + DATALOG_MAX_RECORD_SIZE];
+    uint8_t length = 0;
+
+    if (log->active_size != 0) {
+        length = _datalog_encode_record(buf, log->channels, record, &log->last);
+        if (log->active_size + length > log->segment_size) {
+            // the active segment is full: empty out the older one and start appending there.
+            log->active ^= 1;
+            log->sequence++;
+            log->active_size = 0;
+            log->counts[log->active] = 0;
+        }
+    }
+
+    bool new_segment = log->active_size == 0;
+    if (new_segment) {
+        const datalog_record_t zero = {0};
+        buf[0] = 'D';
+        buf[1] = 'L';
+        buf[2] = DATALOG_VERSION;
+        buf[3] = log->channels;
+        buf[4] = log->sequence & 0xFF;
+        buf[5] = (log->sequence >> 8) & 0xFF;
+        buf[6] = (log->sequence >> 16) & 0xFF;
+        buf[7] = (log->sequence >> 24) & 0xFF;
+        length = DATALOG_HEADER_SIZE + _datalog_encode_record(buf + DATALOG_HEADER_SIZE, log->channels, record, &zero);
+    }
+
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+    _datalog_segment_name(log, log->active, filename);
+    filesystem_file_t *file = filesystem_open(filename, new_segment ? FILESYSTEM_MODE_WRITE : FILESYSTEM_MODE_APPEND);
+    if (file == NULL) return false;
+    bool success = filesystem_write(file, buf, length) == length;
+    success = filesystem_close(file) && success;
+
+    if (!success) {
+        // we don't know how much of the record made it to flash, so the next append starts a fresh segment.
+        log->active_size = log->segment_size;
+        return false;
+    }
+
+    log->active_size += length;
+    log->counts[log->active]++;
+    log->last = *record;
+
+    return true;
+}
+
+uint16_t datalog_count(const datalog_t *log) {
+    return log->counts[0] + log->counts[1];
+}
+
+void datalog_clear(datalog_t *log) {
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+    for (uint8_t segment = 0; segment < 2; segment++) {
+        _datalog_segment_name(log, segment, filename);
+        if (filesystem_file_exists(filename)) filesystem_rm(filename);
+    }
+
+    log->active = 0;
+    log->sequence = 0;
+    log->active_size = 0;
+    log->counts[0] = 0;
+    log->counts[1] = 0;
+    memset(&log->last, 0, sizeof(log->last));
+}
+
+bool datalog_cursor_open(datalog_cursor_t *cursor, const datalog_t *log) {
+    cursor->log = log;
+    cursor->file = NULL;
+    if (datalog_count(log) == 0) return false;
+
+    uint8_t oldest = log->counts[log->active ^ 1] ? log->active ^ 1 : log->active;
+    cursor->segments_left = (oldest == log->active) ? 1 : 2;
+
+    return _datalog_cursor_open_segment(cursor, oldest);
+}
+
+bool datalog_cursor_next(datalog_cursor_t *cursor, datalog_record_t *record) {
+    while (cursor->file != NULL) {
+        if (_datalog_cursor_decode_record(cursor)) {
+            *record = cursor->record;
+            return true;
+        }
+
+        // we've reached the end of this segment; move on to the next one, if there is one.
+        filesystem_close(cursor->file);
+        cursor->file = NULL;
+        if (--cursor->segments_left == 0) break;
+        _datalog_cursor_open_segment(cursor, cursor->segment ^ 1);
+    }
+
+    return false;
+}
+
+void datalog_cursor_close(datalog_cursor_t *cursor) {
+    if (cursor->file == NULL) return;
+    filesystem_close(cursor->file);
+    cursor->file = NULL;
+}
+
+bool datalog_get_recent(const datalog_t *log, uint16_t index, datalog_record_t *record) {
+    uint16_t count = datalog_count(log);
+    if (index >= count) return false;
+
+    datalog_cursor_t cursor;
+    bool found = false;
+    if (datalog_cursor_open(&cursor, log)) {
+        for (uint16_t i = 0; i < count - index; i++) {
+            found = datalog_cursor_next(&cursor, record);
+            if (!found) break;
+        }
+    }
+    datalog_cursor_close(&cursor);
+
+    return found;
+}
@@ -0,0 +1,137 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef DATALOG_H_
+#define DATALOG_H_
+#include <stdint.h>
+#include <stdbool.h>
+#include "filesystem.h"
+
+/*
+ * A compact, append-only log of timestamped sensor readings, stored on the filesystem.
+ *
+ * Each record is a UNIX timestamp plus one to DATALOG_MAX_CHANNELS signed integer values (scale your
+ * readings to integers first, i.e. hundredths of a degree). Records are stored as the difference from the
+ * previous record, zigzag-encoded and packed as varints, so a reading that changes a little every hour
+ * usually takes three or four bytes instead of the eight or more that a struct would.
+ *
+ * A log is two segment files, NAME.0 and NAME.1, of up to segment_size bytes each. New records are appended
+ * to the active segment; when it fills up, the other one is emptied and becomes the active segment. So the
+ * log always holds between one and two segments' worth of the most recent records.
+ *
+ * Appends still cost more than the few bytes they add. Past littlefs's inline limit (32 bytes with our
+ * configuration), a segment is stored in blocks of its own, and littlefs never adds to a block it has
+ * already committed. So each append copies the file's partly filled last block into a newly erased one,
+ * and then commits the new size to the directory. On the internal flash, that is one row erase, up to four
+ * page writes for the copy and the new record, and a metadata commit, for every record.
+ *
+ * Segment layout: an 8 byte header ('D', 'L', version, number of channels, 32-bit little-endian sequence
+ * number; the segment with the higher sequence number is the newer one), followed by records. Each record
+ * is varint(zigzag(timestamp delta)) followed by varint(zigzag(value delta)) for each channel. The first
+ * record in each segment is relative to zero, so each segment can be decoded on its own.
+ */
+
+#define DATALOG_MAX_CHANNELS 4
+#define DATALOG_MAX_NAME_LENGTH 12
+
+typedef struct {
+    uint32_t timestamp; // UNIX time
+    int32_t values[DATALOG_MAX_CHANNELS];
+} datalog_record_t;
+
+typedef struct {
+    char name[DATALOG_MAX_NAME_LENGTH + 1];
+    uint8_t channels;
+    uint8_t active;             // the segment (0 or 1) that we're appending to
+    uint16_t segment_size;      // maximum size of a segment file, in bytes
+    uint16_t active_size;       // current size of the active segment, in bytes
+    uint16_t counts[2];         // number of records in each segment
+    uint32_t sequence;          // the active segment's sequence number
+    datalog_record_t last;      // the most recent record, which the next one is encoded relative to
+} datalog_t;
+
+typedef struct {
+    const datalog_t *log;
+    filesystem_file_t *file;
+    uint8_t segment;            // the segment we're reading
+    uint8_t segments_left;      // including this one
+    uint16_t position;          // offset in the segment of the next unread byte
+    uint8_t start;              // next unread byte in buf
+    uint8_t end;                // one past the last valid byte in buf
+    datalog_record_t record;    // the last record decoded
+    uint8_t buf[32];
+} datalog_cursor_t;
+
+/** @brief Opens a log, scanning any existing segments so that you can append to it.
+  * @param log The log's state, which you provide.
+  * @param name The log's name, which is used to name its segment files. At most DATALOG_MAX_NAME_LENGTH characters.
+  * @param channels How many values each record has, from 1 to DATALOG_MAX_CHANNELS.
+  * @param segment_size The maximum size of each of the log's two segment files, in bytes.
+  * @return true if the log was opened; false if the parameters were invalid. An existing log with a different
+  *         number of channels is ignored, and will be replaced by the first append.
+  */
+bool datalog_open(datalog_t *log, const char *name, uint8_t channels, uint16_t segment_size);
+
+/** @brief Appends a record to the log.
+  * @param log A log opened with datalog_open.
+  * @param record The record to append; only the first log->channels values are stored.
+  * @return true if the record was written; false otherwise.
+  */
+bool datalog_append(datalog_t *log, const datalog_record_t *record);
+
+/** @brief Returns the number of records in the log. */
+uint16_t datalog_count(const datalog_t *log);
+
+/** @brief Removes every record from the log, and deletes its segment files. */
+void datalog_clear(datalog_t *log);
+
+/** @brief Starts reading the log from its oldest record.
+  * @param cursor The cursor's state, which you provide.
+  * @param log A log opened with datalog_open.
+  * @return true if there is anything to read.
+  * @note The cursor holds one of the FILESYSTEM_MAX_OPEN_FILES open files until you call datalog_cursor_close,
+  *       so don't keep one open across events.
+  */
+bool datalog_cursor_open(datalog_cursor_t *cursor, const datalog_t *log);
+
+/** @brief Reads the next record, from oldest to newest.
+  * @param cursor A cursor opened with datalog_cursor_open.
+  * @param record Receives the record.
+  * @return true if a record was read; false once there are no more.
+  */
+bool datalog_cursor_next(datalog_cursor_t *cursor, datalog_record_t *record);
+
+/** @brief Closes a cursor opened with datalog_cursor_open. */
+void datalog_cursor_close(datalog_cursor_t *cursor);
+
+/** @brief Reads one of the most recent records.
+  * @param log A log opened with datalog_open.
+  * @param index 0 for the newest record, 1 for the one before it, and so on.
+  * @param record Receives the record.
+  * @return true if the record was read; false if there is no such record.
+  * @note This decodes the log from the beginning, so if you want several records, use a cursor instead.
+  */
+bool datalog_get_recent(const datalog_t *log, uint16_t index, datalog_record_t *record);
+
+#endif // DATALOG_H_
@@ -3,33 +3,114 @@
 #include <string.h>
 #include <peripheral_clk_config.h>
 #include "filesystem.h"
+#include "kvstore.h"
 #include "watch.h"
+#include "watch_utility.h"
 #include "lfs.h"
 #include "hpl_flash.h"
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+#include "spiflash.h"
+#endif
 
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
 int lfs_storage_sync(const struct lfs_config *cfg);
 
+typedef enum {
+    FILESYSTEM_STATS_READ = 0,
+    FILESYSTEM_STATS_PROG,
+    FILESYSTEM_STATS_ERASE,
+    FILESYSTEM_STATS_SYNC,
+    FILESYSTEM_STATS_NUM_OPS
+} filesystem_stats_op_t;
+
+typedef struct {
+    char filename[FILESYSTEM_STATS_MAX_NAME_LENGTH + 1];    // empty for I/O that isn't about one file, like mounting
+    uint8_t owner;
+    bool in_use;
+    uint32_t ops[FILESYSTEM_STATS_NUM_OPS];
+    uint32_t bytes_read;
+    uint32_t bytes_programmed;
+    uint32_t time_us;       // CPU time spent in the storage calls
+} filesystem_stats_entry_t;
+
+// for the fsstat command: flash I/O by file and by who asked for it. the last entry catches anything that doesn't fit.
+static filesystem_stats_entry_t stats[FILESYSTEM_STATS_ENTRIES];
+// the file and owner that I/O is currently being charged to.
+static char stats_filename[FILESYSTEM_STATS_MAX_NAME_LENGTH + 1];
+static uint8_t stats_owner = FILESYSTEM_STATS_OWNER_NONE;
+
+static void _filesystem_stats_set_file(const char *filename) {
+    strncpy(stats_filename, filename, FILESYSTEM_STATS_MAX_NAME_LENGTH);
+    stats_filename[FILESYSTEM_STATS_MAX_NAME_LENGTH] = 0;
+}
+
+static void _filesystem_stats_count(filesystem_stats_op_t op, lfs_size_t size) {
+    uint32_t elapsed = watch_cycle_timer_get_us();
+    filesystem_stats_entry_t *entry = &stats[FILESYSTEM_STATS_ENTRIES - 1];
+
+    for (uint8_t i = 0; i < FILESYSTEM_STATS_ENTRIES - 1; i++) {
+        if (!stats[i].in_use) {
+            stats[i].in_use = true;
+            strcpy(stats[i].filename, stats_filename);
+            stats[i].owner = stats_owner;
+            entry = &stats[i];
+            break;
+        }
+        if (stats[i].owner == stats_owner && !strcmp(stats[i].filename, stats_filename)) {
+            entry = &stats[i];
+            break;
+        }
+    }
+    if (entry == &stats[FILESYSTEM_STATS_ENTRIES - 1] && !entry->in_use) {
+        entry->in_use = true;
+        strcpy(entry->filename, "(other)");
+        entry->owner = FILESYSTEM_STATS_OWNER_NONE;
+    }
+
+    entry->ops[op]++;
+    if (op == FILESYSTEM_STATS_READ) entry->bytes_read += size;
+    if (op == FILESYSTEM_STATS_PROG) entry->bytes_programmed += size;
+    entry->time_us += elapsed;
+}
+
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_read(block, off, (void *)buffer, size);
+    watch_cycle_timer_start();
+    int err = !watch_storage_read(block, off, (void *)buffer, size);
+    _filesystem_stats_count(FILESYSTEM_STATS_READ, size);
+    return err;
 }
 
+// free space in bytes, or -1 if it needs to be recalculated. block usage can only change when littlefs
+// writes to flash, so the storage shims below throw it away on every prog and erase.
+static int32_t free_space = -1;
+
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_write(block, off, (void *)buffer, size);
+    free_space = -1;
+    watch_cycle_timer_start();
+    int err = !watch_storage_write(block, off, (void *)buffer, size);
+    _filesystem_stats_count(FILESYSTEM_STATS_PROG, size);
+    return err;
 }
 
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
     (void) cfg;
-    return !watch_storage_erase(block);
+    free_space = -1;
+    watch_cycle_timer_start();
+    int err = !watch_storage_erase(block);
+    _filesystem_stats_count(FILESYSTEM_STATS_ERASE, 0);
+    return err;
 }
 
 int lfs_storage_sync(const struct lfs_config *cfg) {
     (void) cfg;
-    return !watch_storage_sync();
+    watch_cycle_timer_start();
+    int err = !watch_storage_sync();
+    _filesystem_stats_count(FILESYSTEM_STATS_SYNC, 0);
+    return err;
 }
 
 const struct lfs_config cfg = {
@@ -43,16 +124,334 @@ const struct lfs_config cfg = {
     .read_size = 16,
     .prog_size = NVMCTRL_PAGE_SIZE,
     .block_size = NVMCTRL_ROW_SIZE,
-    .block_count = NVMCTRL_RWWEE_PAGES / 4,
+    // the last KVSTORE_ROWS rows belong to the key-value store.
+    .block_count = NVMCTRL_RWWEE_PAGES / 4 - KVSTORE_ROWS,
     .cache_size = NVMCTRL_PAGE_SIZE,
     .lookahead_size = 16,
     .block_cycles = 100,
 };
 
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+
+#define FILESYSTEM_EXTERNAL_PAGE_SIZE 256
+#define FILESYSTEM_EXTERNAL_SECTOR_SIZE 4096
+
+typedef struct {
+    uint32_t address;       // flash address of the cached page, or UINT32_MAX if this slot is empty
+    uint32_t last_used;
+    uint8_t data[FILESYSTEM_EXTERNAL_PAGE_SIZE];
+} filesystem_external_page_t;
+
+// the most recently used pages of the external flash. littlefs goes back to the same metadata pages over and over,
+// and reading a whole page costs little more than the command and address bytes we'd have to send for a few bytes.
+// allocated when the external volume is mounted, so builds that don't use it don't pay for it.
+static filesystem_external_page_t *external_cache;
+static uint32_t external_cache_clock;
+
+static filesystem_external_page_t *_filesystem_external_cache_find(uint32_t address) {
+    for (uint8_t i = 0; i < FILESYSTEM_EXTERNAL_CACHE_PAGES; i++) {
+        if (external_cache[i].address == address) {
+            external_cache[i].last_used = ++external_cache_clock;
+            return &external_cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+int lfs_external_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
+int lfs_external_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    uint32_t address = block * cfg->block_size + off;
+    uint8_t *out = buffer;
+    watch_cycle_timer_start();
+
+    while (size) {
+        uint32_t page_address = address & ~(FILESYSTEM_EXTERNAL_PAGE_SIZE - 1);
+        uint32_t page_offset = address - page_address;
+        uint32_t chunk = min(size, FILESYSTEM_EXTERNAL_PAGE_SIZE - page_offset);
+        filesystem_external_page_t *page = _filesystem_external_cache_find(page_address);
+        if (page == NULL) {
+            page = &external_cache[0];
+            for (uint8_t i = 1; i < FILESYSTEM_EXTERNAL_CACHE_PAGES; i++) {
+                if (external_cache[i].last_used < page->last_used) page = &external_cache[i];
+            }
+            page->address = UINT32_MAX;
+            if (!spi_flash_read_data(page_address, page->data, FILESYSTEM_EXTERNAL_PAGE_SIZE)) return LFS_ERR_IO;
+            page->address = page_address;
+            page->last_used = ++external_cache_clock;
+        }
+        memcpy(out, page->data + page_offset, chunk);
+        out += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+
+    _filesystem_stats_count(FILESYSTEM_STATS_READ, out - (uint8_t *)buffer);
+    return LFS_ERR_OK;
+}
+
+int lfs_external_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
+int lfs_external_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    uint32_t address = block * cfg->block_size + off;
+    const uint8_t *in = buffer;
+    watch_cycle_timer_start();
+
+    // this returns once the data has been sent; the chip finishes programming it while littlefs gets on with
+    // the next one, and the driver waits for it before the next command.
+    if (!spi_flash_program(address, (uint8_t *)buffer, size)) return LFS_ERR_IO;
+
+    // programming can only clear bits, so that's what happens to the cached copy too.
+    lfs_size_t total = size;
+    while (size) {
+        uint32_t page_address = address & ~(FILESYSTEM_EXTERNAL_PAGE_SIZE - 1);
+        uint32_t page_offset = address - page_address;
+        uint32_t chunk = min(size, FILESYSTEM_EXTERNAL_PAGE_SIZE - page_offset);
+        filesystem_external_page_t *page = _filesystem_external_cache_find(page_address);
+        if (page != NULL) {
+            for (uint32_t i = 0; i < chunk; i++) page->data[page_offset + i] &= in[i];
+        }
+        in += chunk;
+        address += chunk;
+        size -= chunk;
+    }
+
+    _filesystem_stats_count(FILESYSTEM_STATS_PROG, total);
+    return LFS_ERR_OK;
+}
+
+int lfs_external_erase(const struct lfs_config *cfg, lfs_block_t block);
+int lfs_external_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    uint32_t address = block * cfg->block_size;
+    watch_cycle_timer_start();
+    if (!spi_flash_command(CMD_ENABLE_WRITE) ||
+        !spi_flash_sector_command(CMD_SECTOR_ERASE, address)) return LFS_ERR_IO;
+
+    for (uint8_t i = 0; i < FILESYSTEM_EXTERNAL_CACHE_PAGES; i++) {
+        if (external_cache[i].address - address < FILESYSTEM_EXTERNAL_SECTOR_SIZE) memset(external_cache[i].data, 0xFF, FILESYSTEM_EXTERNAL_PAGE_SIZE);
+    }
+
+    _filesystem_stats_count(FILESYSTEM_STATS_ERASE, 0);
+    return LFS_ERR_OK;
+}
+
+int lfs_external_sync(const struct lfs_config *cfg);
+int lfs_external_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    watch_cycle_timer_start();
+    int err = spi_flash_wait_ready() ? LFS_ERR_OK : LFS_ERR_IO;
+    _filesystem_stats_count(FILESYSTEM_STATS_SYNC, 0);
+    return err;
+}
+
+// block_count is filled in from the flash chip's JEDEC ID when the volume is mounted.
+static struct lfs_config external_cfg = {
+    // block device operations
+    .read  = lfs_external_read,
+    .prog  = lfs_external_prog,
+    .erase = lfs_external_erase,
+    .sync  = lfs_external_sync,
+
+    // block device configuration. NOR flash can program any number of bytes, so the read, prog and cache sizes
+    // match the internal filesystem; that way, files on either volume can share the same open file buffers.
+    .read_size = 16,
+    .prog_size = NVMCTRL_PAGE_SIZE,
+    .block_size = FILESYSTEM_EXTERNAL_SECTOR_SIZE,
+    .cache_size = NVMCTRL_PAGE_SIZE,
+    .lookahead_size = 16,
+    .block_cycles = 500,
+};
+
+static lfs_t external_lfs;
+static bool external_mounted = false;
+
+#endif
+
 static lfs_t lfs;
 static lfs_file_t file;
 static struct lfs_info info;
 
+struct filesystem_file {
+    lfs_file_t file;
+    lfs_t *volume;          // the littlefs instance the file is on
+    struct lfs_file_config config;
+    uint8_t cache[NVMCTRL_PAGE_SIZE];
+    char filename[FILESYSTEM_STATS_MAX_NAME_LENGTH + 1];   // for the I/O statistics
+    bool in_use;
+};
+
+// files opened with filesystem_open; each has its own cache so littlefs doesn't need to malloc one.
+static struct filesystem_file open_files[FILESYSTEM_MAX_OPEN_FILES];
+
+typedef struct {
+    char filename[FILESYSTEM_CACHE_MAX_NAME_LENGTH + 1];
+    char *data;             // NULL if this slot is free
+    int32_t length;
+    uint32_t dirty_since;   // when the oldest unflushed write to this file happened
+    uint8_t owner;          // who wrote it, so that flushing it later is charged to them
+} filesystem_cache_entry_t;
+
+// files written with filesystem_write_file_cached that haven't been written to flash yet.
+static filesystem_cache_entry_t write_cache[FILESYSTEM_CACHE_SLOTS];
+
+// for the df command: how many littlefs commits the write cache has saved so far.
+static struct {
+    uint32_t since;
+    uint32_t writes_absorbed;
+    uint32_t flushes;
+} write_cache_stats;
+
+static uint32_t _filesystem_now(void) {
+    return watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+}
+
+static filesystem_cache_entry_t *_filesystem_cache_find(char *filename) {
+    for (uint8_t i = 0; i < FILESYSTEM_CACHE_SLOTS; i++) {
+        if (write_cache[i].data != NULL && !strcmp(write_cache[i].filename, filename)) return &write_cache[i];
+    }
+
+    return NULL;
+}
+
+static void _filesystem_cache_discard(filesystem_cache_entry_t *entry) {
+    free(entry->data);
+    entry->data = NULL;
+}
+
+static bool _filesystem_write_file(char *filename, char *text, int32_t length);
+
+static bool _filesystem_cache_flush_entry(filesystem_cache_entry_t *entry) {
+    uint8_t owner = filesystem_set_stats_owner(entry->owner);
+    bool success = _filesystem_write_file(entry->filename, entry->data, entry->length);
+    filesystem_set_stats_owner(owner);
+    // if this fails, keep the entry around so that we can try again later.
+    if (!success) return false;
+    write_cache_stats.flushes++;
+    _filesystem_cache_discard(entry);
+
+    return true;
+}
+
+static bool _filesystem_cache_flush_file(char *filename) {
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry == NULL) return true;
+
+    return _filesystem_cache_flush_entry(entry);
+}
+
+// the filesystem isn't mounted until something needs it, so builds that never touch it don't pay for the
+// metadata scan at boot.
+static bool mounted = false;
+static int32_t mount_time = -1;
+
+typedef struct {
+    uint32_t used;      // number of blocks in use
+    lfs_block_t end;    // one past the highest block in use
+} filesystem_usage_t;
+
+static int _traverse_usage_cb(void *p, lfs_block_t block) {
+    filesystem_usage_t *usage = p;
+    usage->used++;
+    if (block >= usage->end) usage->end = block + 1;
+    return 0;
+}
+
+// Older firmware gave littlefs every row of the storage area; the last KVSTORE_ROWS now belong to the key-value
+// store. A filesystem made that way is never reformatted or copied: it stays at its old size, and the key-value
+// store stays off, until none of its blocks are in those rows (or someone runs format).
+static struct lfs_config legacy_cfg;
+// whichever of cfg and legacy_cfg the filesystem is mounted with.
+static const struct lfs_config *volume_cfg = &cfg;
+// set once we know that the filesystem has nothing in the key-value store's rows.
+static bool kvstore_rows_free = false;
+
+// a root attribute with the block count the filesystem was checked or formatted at, so that we only have to
+// look for blocks in the key-value store's rows once.
+#define FILESYSTEM_ATTR_BLOCK_COUNT 's'
+
+static void _filesystem_mark_sized(void) {
+    lfs_size_t block_count = cfg.block_count;
+    // if this doesn't stick, we just check again at the next mount.
+    lfs_setattr(&lfs, "/", FILESYSTEM_ATTR_BLOCK_COUNT, &block_count, sizeof(block_count));
+    kvstore_rows_free = true;
+}
+
+static int _filesystem_mount_legacy(void) {
+    legacy_cfg = cfg;
+    legacy_cfg.block_count = NVMCTRL_RWWEE_PAGES / 4;
+    int err = lfs_mount(&lfs, &legacy_cfg);
+    if (err == LFS_ERR_OK) {
+        volume_cfg = &legacy_cfg;
+        printf("Filesystem is from older firmware; the key-value store is off until it is formatted.\r\n");
+    }
+    return err;
+}
+
+/// @brief Called once the filesystem has mounted at the new size, to make sure it has no blocks past the end.
+/// @return The result of mounting it again at the old size if it does, or LFS_ERR_OK.
+static int _filesystem_check_size(void) {
+    lfs_size_t block_count = 0;
+    if (lfs_getattr(&lfs, "/", FILESYSTEM_ATTR_BLOCK_COUNT, &block_count, sizeof(block_count)) == (lfs_ssize_t)sizeof(block_count) &&
+        block_count == cfg.block_count) {
+        kvstore_rows_free = true;
+        return LFS_ERR_OK;
+    }
+
+    // older littlefs doesn't compare the block count with the superblock's, so a filesystem made by older firmware
+    // mounts at the new size too. since we have to traverse it to find out, keep the free space that falls out of it.
+    filesystem_usage_t usage = {0};
+    // if we can't tell, leave the rows alone and try again at the next mount.
+    if (lfs_fs_traverse(&lfs, _traverse_usage_cb, &usage) < 0) return LFS_ERR_OK;
+    if (usage.end <= cfg.block_count) {
+        // nothing to move, so it has already shrunk as far as littlefs can tell.
+        _filesystem_mark_sized();
+        free_space = (int32_t)((cfg.block_count - usage.used) * cfg.block_size);
+        return LFS_ERR_OK;
+    }
+
+    lfs_unmount(&lfs);
+    int err = _filesystem_mount_legacy();
+    // if it won't mount at the old size either, those blocks can't be right; carry on without the rows.
+    if (err < 0) err = lfs_mount(&lfs, &cfg);
+    return err;
+}
+
+static bool _filesystem_mount(void) {
+    if (mounted) return true;
+
+    uint32_t start = watch_get_boot_timer_us();
+    _filesystem_stats_set_file("");
+    volume_cfg = &cfg;
+    int err = lfs_mount(&lfs, &cfg);
+    if (err == LFS_ERR_OK) {
+        if (!kvstore_rows_free) err = _filesystem_check_size();
+    } else {
+        // newer littlefs won't mount a filesystem at any size but the one it was made at, so try the old one too.
+        err = _filesystem_mount_legacy();
+    }
+
+    // reformat if we can't mount the filesystem
+    // this should only happen on the first boot
+    bool formatted = false;
+    if (err < 0) {
+        printf("Ignore that error! Formatting filesystem...\r\n");
+        volume_cfg = &cfg;
+        err = lfs_format(&lfs, &cfg);
+        if (err < 0) return false;
+        err = lfs_mount(&lfs, &cfg);
+        if (err == LFS_ERR_OK) _filesystem_mark_sized();
+        formatted = true;
+    }
+    if (err < 0) return false;
+
+    mounted = true;
+    // the boot timer stops once boot is over, in which case this is 0.
+    uint32_t end = watch_get_boot_timer_us();
+    mount_time = end > start ? end - start : 0;
+    if (formatted) printf("Filesystem mounted with %ld bytes free.\r\n", (long)filesystem_get_free_space());
+
+    return true;
+}
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -60,22 +459,86 @@ static int _traverse_df_cb(void *p, lfs_block_t block) {
 	return 0;
 }
 
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+
+static bool _filesystem_external_mount(void) {
+    if (external_mounted) return true;
+
+    // ask the chip how big it is. the last byte of the JEDEC ID is log2 of the capacity in bytes on every
+    // SPI NOR flash we're likely to see.
+    uint8_t jedec_id[3];
+    spi_flash_init();
+    if (!spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, sizeof(jedec_id)) ||
+        jedec_id[0] == 0x00 || jedec_id[0] == 0xFF || jedec_id[2] < 16 || jedec_id[2] > 24) {
+        printf("No external flash found\r\n");
+        return false;
+    }
+    external_cfg.block_count = (1UL << jedec_id[2]) / FILESYSTEM_EXTERNAL_SECTOR_SIZE;
+
+    if (external_cache == NULL) {
+        external_cache = malloc(sizeof(filesystem_external_page_t) * FILESYSTEM_EXTERNAL_CACHE_PAGES);
+        if (external_cache == NULL) return false;
+    }
+    for (uint8_t i = 0; i < FILESYSTEM_EXTERNAL_CACHE_PAGES; i++) {
+        external_cache[i].address = UINT32_MAX;
+        external_cache[i].last_used = 0;
+    }
+
+    _filesystem_stats_set_file(FILESYSTEM_EXTERNAL_PREFIX);
+    int err = lfs_mount(&external_lfs, &external_cfg);
+    if (err < 0) {
+        printf("Formatting external flash...\r\n");
+        err = lfs_format(&external_lfs, &external_cfg);
+        if (err < 0) return false;
+        err = lfs_mount(&external_lfs, &external_cfg);
+    }
+    if (err < 0) return false;
+
+    external_mounted = true;
+    return true;
+}
+
+#endif
+
+/// @brief Finds the volume a file is on, and mounts it if need be.
+/// @param filename The file's name; if it's on the external flash, this is advanced past FILESYSTEM_EXTERNAL_PREFIX.
+/// @return The littlefs instance to use, or NULL if the volume isn't available.
+static lfs_t *_filesystem_volume(char **filename) {
+    if (!strncmp(*filename, FILESYSTEM_EXTERNAL_PREFIX, sizeof(FILESYSTEM_EXTERNAL_PREFIX) - 1)) {
+        *filename += sizeof(FILESYSTEM_EXTERNAL_PREFIX) - 1;
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+        return _filesystem_external_mount() ? &external_lfs : NULL;
+#else
+        return NULL;
+#endif
+    }
+
+    return _filesystem_mount() ? &lfs : NULL;
+}
+
 int32_t filesystem_get_free_space(void) {
 	int err;
 
+	// traversing the filesystem reads every metadata block, so only do it if something has changed.
+	if (free_space >= 0) return free_space;
+	if (!_filesystem_mount()) return LFS_ERR_IO;
+	_filesystem_stats_set_file("");
+
 	uint32_t free_blocks = 0;
 	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
 	if(err < 0){
 		return err;
 	}
 
-	uint32_t available = cfg.block_count * cfg.block_size - free_blocks * cfg.block_size;
+	uint32_t available = volume_cfg->block_count * volume_cfg->block_size - free_blocks * volume_cfg->block_size;
+	free_space = (int32_t)available;
 
-	return (int32_t)available;
+	return free_space;
 }
 
 static int filesystem_ls(lfs_t *lfs, const char *path) {
     lfs_dir_t dir;
+    _filesystem_stats_set_file("");
     int err = lfs_dir_open(lfs, &dir, path);
     if (err < 0) {
         return err;
@@ -112,48 +575,66 @@ static int filesystem_ls(lfs_t *lfs, const char *path) {
 }
 
 bool filesystem_init(void) {
-    int err = lfs_mount(&lfs, &cfg);
-
-    // reformat if we can't mount the filesystem
-    // this should only happen on the first boot
-    if (err < 0) {
-        printf("Ignore that error! Formatting filesystem...\r\n");
-        err = lfs_format(&lfs, &cfg);
-        if (err < 0) return false;
-        err = lfs_mount(&lfs, &cfg);
-        printf("Filesystem mounted with %ld bytes free.\r\n", filesystem_get_free_space());
-    }
+    return _filesystem_mount();
+}
 
-    return err == LFS_ERR_OK;
+int32_t filesystem_get_mount_time(void) {
+    return mount_time;
 }
 
 int _filesystem_format(void);
 int _filesystem_format(void) {
-    int err = lfs_unmount(&lfs);
-    if (err < 0) {
-        printf("Couldn't unmount - continuing to format, but you should reboot afterwards!\r\n");
+    // nothing in the write cache is going to survive this.
+    for (uint8_t i = 0; i < FILESYSTEM_CACHE_SLOTS; i++) {
+        if (write_cache[i].data != NULL) _filesystem_cache_discard(&write_cache[i]);
+    }
+
+    int err;
+    if (mounted) {
+        err = lfs_unmount(&lfs);
+        if (err < 0) {
+            printf("Couldn't unmount - continuing to format, but you should reboot afterwards!\r\n");
+        }
+        mounted = false;
     }
 
+    _filesystem_stats_set_file("");
+    // this is also how a filesystem from older firmware gives the key-value store its rows back.
+    volume_cfg = &cfg;
     err = lfs_format(&lfs, &cfg);
     if (err < 0) return err;
 
     err = lfs_mount(&lfs, &cfg);
     if (err < 0) return err;
+    mounted = true;
+    _filesystem_mark_sized();
     printf("Filesystem re-mounted with %ld bytes free.\r\n", filesystem_get_free_space());
     return 0;
 }
 
 bool filesystem_file_exists(char *filename) {
+    if (_filesystem_cache_find(filename) != NULL) return true;
+    char *path = filename;
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return false;
+    _filesystem_stats_set_file(filename);
     info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    lfs_stat(volume, path, &info);
     return info.type == LFS_TYPE_REG;
 }
 
 bool filesystem_rm(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    char *path = filename;
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return false;
+    // a cached copy never needs to reach flash now; and a file that so far only exists in the cache is gone.
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry != NULL) _filesystem_cache_discard(entry);
     if (filesystem_file_exists(filename)) {
-        return lfs_remove(&lfs, filename) == LFS_ERR_OK;
+        _filesystem_stats_set_file(filename);
+        return lfs_remove(volume, path) == LFS_ERR_OK;
+    } else if (entry != NULL) {
+        return true;
     } else {
         printf("rm: %s: No such file\r\n", filename);
         return false;
@@ -161,6 +642,9 @@ bool filesystem_rm(char *filename) {
 }
 
 int32_t filesystem_get_file_size(char *filename) {
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry != NULL) return entry->length;
+
     if (filesystem_file_exists(filename)) {
         return info.size; // info struct was just populated by filesystem_file_exists
     }
@@ -170,13 +654,21 @@ int32_t filesystem_get_file_size(char *filename) {
 
 bool filesystem_read_file(char *filename, char *buf, int32_t length) {
     memset(buf, 0, length);
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry != NULL) {
+        memcpy(buf, entry->data, min(length, entry->length));
+        return true;
+    }
+
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        char *path = filename;
+        lfs_t *volume = _filesystem_volume(&path);
+        int err = lfs_file_open(volume, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length, file_size));
+        err = lfs_file_read(volume, &file, buf, min(length, file_size));
         if (err < 0) return false;
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(volume, &file) == LFS_ERR_OK;
     }
 
     return false;
@@ -184,13 +676,16 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length) {
 
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
     memset(buf, 0, length + 1);
+    _filesystem_cache_flush_file(filename);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        char *path = filename;
+        lfs_t *volume = _filesystem_volume(&path);
+        int err = lfs_file_open(volume, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_seek(&lfs, &file, *offset, LFS_SEEK_SET);
+        err = lfs_file_seek(volume, &file, *offset, LFS_SEEK_SET);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length - 1, file_size - *offset));
+        err = lfs_file_read(volume, &file, buf, min(length - 1, file_size - *offset));
         if (err < 0) return false;
         for(int i = 0; i < length; i++) {
             (*offset)++;
@@ -199,15 +694,126 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
                 break;
             }
         }
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(volume, &file) == LFS_ERR_OK;
     }
 
     return false;
 }
 
+filesystem_file_t *filesystem_open(char *filename, filesystem_mode_t mode) {
+    int flags;
+    switch (mode) {
+        case FILESYSTEM_MODE_READ:
+            flags = LFS_O_RDONLY;
+            break;
+        case FILESYSTEM_MODE_WRITE:
+            flags = LFS_O_WRONLY | LFS_O_CREAT | LFS_O_TRUNC;
+            break;
+        case FILESYSTEM_MODE_APPEND:
+            flags = LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND;
+            break;
+        default:
+            return NULL;
+    }
+    char *path = filename;
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return NULL;
+
+    if (mode == FILESYSTEM_MODE_WRITE) {
+        // we're about to replace the file, so a cached copy would only be written out to be overwritten.
+        filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+        if (entry != NULL) _filesystem_cache_discard(entry);
+    } else {
+        _filesystem_cache_flush_file(filename);
+    }
+
+    for (uint8_t i = 0; i < FILESYSTEM_MAX_OPEN_FILES; i++) {
+        filesystem_file_t *handle = &open_files[i];
+        if (handle->in_use) continue;
+
+        memset(&handle->config, 0, sizeof(handle->config));
+        handle->config.buffer = handle->cache;
+        _filesystem_stats_set_file(filename);
+        if (lfs_file_opencfg(volume, &handle->file, path, flags, &handle->config) < 0) return NULL;
+        strcpy(handle->filename, stats_filename);
+        handle->volume = volume;
+        handle->in_use = true;
+
+        return handle;
+    }
+
+    printf("Too many open files\r\n");
+    return NULL;
+}
+
+int32_t filesystem_read(filesystem_file_t *file, void *buf, int32_t length) {
+    _filesystem_stats_set_file(file->filename);
+    return lfs_file_read(file->volume, &file->file, buf, length);
+}
+
+int32_t filesystem_write(filesystem_file_t *file, const void *buf, int32_t length) {
+    _filesystem_stats_set_file(file->filename);
+    return lfs_file_write(file->volume, &file->file, buf, length);
+}
+
+int32_t filesystem_seek(filesystem_file_t *file, int32_t offset) {
+    _filesystem_stats_set_file(file->filename);
+    return lfs_file_seek(file->volume, &file->file, offset, LFS_SEEK_SET);
+}
+
+bool filesystem_close(filesystem_file_t *file) {
+    // closing a file we wrote to is when littlefs commits it.
+    _filesystem_stats_set_file(file->filename);
+    int err = lfs_file_close(file->volume, &file->file);
+    file->in_use = false;
+    return err == LFS_ERR_OK;
+}
+
+bool filesystem_line_reader_open(filesystem_line_reader_t *reader, char *filename) {
+    reader->file = filesystem_open(filename, FILESYSTEM_MODE_READ);
+    reader->position = 0;
+    reader->line_offset = 0;
+    reader->start = 0;
+    reader->end = 0;
+
+    return reader->file != NULL;
+}
+
+bool filesystem_line_reader_next(filesystem_line_reader_t *reader, char *line, int32_t length) {
+    if (reader->file == NULL || length < 1) return false;
+
+    int32_t count = 0;
+    bool read_anything = false;
+    reader->line_offset = reader->position;
+
+    while (true) {
+        // refill the buffer a whole cache line at a time, instead of going back to littlefs for every line.
+        if (reader->start == reader->end) {
+            int32_t bytes_read = filesystem_read(reader->file, reader->buf, sizeof(reader->buf));
+            if (bytes_read <= 0) break;
+            reader->start = 0;
+            reader->end = bytes_read;
+        }
+
+        char c = reader->buf[reader->start++];
+        reader->position++;
+        read_anything = true;
+        if (c == '\n') break;
+        if (count < length - 1) line[count++] = c;
+    }
+    line[count] = 0;
+
+    return read_anything;
+}
+
+void filesystem_line_reader_close(filesystem_line_reader_t *reader) {
+    if (reader->file == NULL) return;
+    filesystem_close(reader->file);
+    reader->file = NULL;
+}
+
 static void filesystem_cat(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    _filesystem_cache_flush_file(filename);
     if (filesystem_file_exists(filename)) {
         if (info.size > 0) {
             char *buf = malloc(info.size + 1);
@@ -223,28 +829,127 @@ static void filesystem_cat(char *filename) {
     }
 }
 
-bool filesystem_write_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+static bool _filesystem_write_file(char *filename, char *text, int32_t length) {
+    char *path = filename;
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return false;
+    _filesystem_stats_set_file(filename);
+    int err = lfs_file_open(volume, &file, path, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    err = lfs_file_write(volume, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(volume, &file) == LFS_ERR_OK;
+}
+
+bool filesystem_write_file(char *filename, char *text, int32_t length) {
+    // this write supersedes anything still waiting in the cache.
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry != NULL) _filesystem_cache_discard(entry);
+
+    return _filesystem_write_file(filename, text, length);
+}
+
+bool filesystem_write_file_cached(char *filename, char *text, int32_t length) {
+    if (length > FILESYSTEM_CACHE_MAX_FILE_SIZE || strlen(filename) > FILESYSTEM_CACHE_MAX_NAME_LENGTH) {
+        return filesystem_write_file(filename, text, length);
+    }
+
+    filesystem_cache_entry_t *entry = _filesystem_cache_find(filename);
+    if (entry != NULL) {
+        // this write replaces one that never made it to flash: that's a commit saved.
+        write_cache_stats.writes_absorbed++;
+        if (entry->length != length) {
+            // a slot is in use while it has a buffer, so an empty file still gets a byte.
+            char *data = realloc(entry->data, length ? length : 1);
+            if (data == NULL) {
+                _filesystem_cache_discard(entry);
+                return filesystem_write_file(filename, text, length);
+            }
+            entry->data = data;
+            entry->length = length;
+        }
+        memcpy(entry->data, text, length);
+        return true;
+    }
+
+    // find a free slot, or make one by flushing the file that has been waiting the longest.
+    for (uint8_t i = 0; i < FILESYSTEM_CACHE_SLOTS; i++) {
+        if (write_cache[i].data == NULL) {
+            entry = &write_cache[i];
+            break;
+        }
+        if (entry == NULL || write_cache[i].dirty_since < entry->dirty_since) entry = &write_cache[i];
+    }
+    if (entry->data != NULL && !_filesystem_cache_flush_entry(entry)) {
+        return filesystem_write_file(filename, text, length);
+    }
+
+    entry->data = malloc(length ? length : 1);
+    if (entry->data == NULL) return filesystem_write_file(filename, text, length);
+    memcpy(entry->data, text, length);
+    entry->length = length;
+    strcpy(entry->filename, filename);
+    entry->dirty_since = _filesystem_now();
+    entry->owner = stats_owner;
+    if (write_cache_stats.since == 0) write_cache_stats.since = entry->dirty_since;
+
+    return true;
+}
+
+bool filesystem_flush(void) {
+    bool success = true;
+    for (uint8_t i = 0; i < FILESYSTEM_CACHE_SLOTS; i++) {
+        if (write_cache[i].data != NULL) success = _filesystem_cache_flush_entry(&write_cache[i]) && success;
+    }
+
+    return success;
+}
+
+void filesystem_flush_if_stale(void) {
+    uint32_t now = 0;
+    for (uint8_t i = 0; i < FILESYSTEM_CACHE_SLOTS; i++) {
+        if (write_cache[i].data == NULL) continue;
+        // only read the RTC if there's something in the cache.
+        if (now == 0) now = _filesystem_now();
+        if (now - write_cache[i].dirty_since >= FILESYSTEM_CACHE_DIRTY_TIMEOUT) _filesystem_cache_flush_entry(&write_cache[i]);
+    }
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    char *path = filename;
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return false;
+    _filesystem_cache_flush_file(filename);
+    _filesystem_stats_set_file(filename);
+    int err = lfs_file_open(volume, &file, path, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    err = lfs_file_write(volume, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(volume, &file) == LFS_ERR_OK;
+}
+
+void filesystem_sleep(void) {
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    if (external_mounted) spi_flash_power_down();
+#endif
+}
+
+bool filesystem_kvstore_rows_free(void) {
+    return _filesystem_mount() && kvstore_rows_free;
+}
+
+uint8_t filesystem_set_stats_owner(uint8_t owner) {
+    uint8_t previous = stats_owner;
+    stats_owner = owner;
+    return previous;
 }
 
 int filesystem_cmd_ls(int argc, char *argv[]) {
-    if (argc >= 2) {
-        filesystem_ls(&lfs, argv[1]);
-    } else {
-        filesystem_ls(&lfs, "/");
-    }
+    char *path = argc >= 2 ? argv[1] : "/";
+    lfs_t *volume = _filesystem_volume(&path);
+    if (volume == NULL) return 1;
+    filesystem_flush();
+    filesystem_ls(volume, path[0] ? path : "/");
     return 0;
 }
 
@@ -257,7 +962,24 @@ int filesystem_cmd_cat(int argc, char *argv[]) {
 int filesystem_cmd_df(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
+    filesystem_flush();
     printf("free space: %ld bytes\r\n", filesystem_get_free_space());
+#ifdef FILESYSTEM_EXTERNAL_FLASH
+    uint32_t used_blocks = 0;
+    if (_filesystem_external_mount() && lfs_fs_traverse(&external_lfs, _traverse_df_cb, &used_blocks) == LFS_ERR_OK) {
+        printf("external flash: %lu of %lu bytes free\r\n",
+               (unsigned long)((external_cfg.block_count - used_blocks) * external_cfg.block_size),
+               (unsigned long)(external_cfg.block_count * external_cfg.block_size));
+    }
+#endif
+
+    // each absorbed write is a littlefs commit (and its share of row erases) that never had to happen.
+    printf("write cache: %lu writes absorbed, %lu flushes", (unsigned long)write_cache_stats.writes_absorbed, (unsigned long)write_cache_stats.flushes);
+    uint32_t elapsed = write_cache_stats.since ? _filesystem_now() - write_cache_stats.since : 0;
+    if (elapsed > 0) {
+        printf(", about %lu commits saved per day", (unsigned long)((uint64_t)write_cache_stats.writes_absorbed * 86400 / elapsed));
+    }
+    printf("\r\n");
     return 0;
 }
 
@@ -305,3 +1027,33 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
 
     return 0;
 }
+
+int filesystem_cmd_fsstat(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    printf("owner file          reads  bytes  progs  bytes erases  syncs   cpu us\r\n");
+    for (uint8_t i = 0; i < FILESYSTEM_STATS_ENTRIES; i++) {
+        filesystem_stats_entry_t *entry = &stats[i];
+        if (!entry->in_use) continue;
+        char owner[6];
+        if (entry->owner == FILESYSTEM_STATS_OWNER_SHELL) strcpy(owner, "shell");
+        else if (entry->owner == FILESYSTEM_STATS_OWNER_NONE) strcpy(owner, "-");
+        else sprintf(owner, "%d", entry->owner);
+        printf("%-5s %-12s %6lu %6lu %6lu %6lu %6lu %6lu %8lu\r\n",
+               owner,
+               entry->filename[0] ? entry->filename : "(fs)",
+               (unsigned long)entry->ops[FILESYSTEM_STATS_READ],
+               (unsigned long)entry->bytes_read,
+               (unsigned long)entry->ops[FILESYSTEM_STATS_PROG],
+               (unsigned long)entry->bytes_programmed,
+               (unsigned long)entry->ops[FILESYSTEM_STATS_ERASE],
+               (unsigned long)entry->ops[FILESYSTEM_STATS_SYNC],
+               (unsigned long)entry->time_us);
+    }
+
+    // start counting afresh, so that running this again shows what happened in between.
+    memset(stats, 0, sizeof(stats));
+
+    return 0;
+}
@@ -28,12 +28,79 @@
 #include <stdbool.h>
 #include "watch.h"
 
+/// @brief A file opened with filesystem_open. Its contents are private to filesystem.c.
+typedef struct filesystem_file filesystem_file_t;
+
+/// @brief How to open a file. @see filesystem_open
+typedef enum {
+    FILESYSTEM_MODE_READ = 0,   // read from the start of an existing file
+    FILESYSTEM_MODE_WRITE,      // create the file, or replace its contents if it exists
+    FILESYSTEM_MODE_APPEND,     // create the file, or add to the end of it if it exists
+} filesystem_mode_t;
+
+/// @brief The number of files that can be open at once.
+#define FILESYSTEM_MAX_OPEN_FILES 2
+
+#define FILESYSTEM_LINE_READER_BUFFER_SIZE 64
+
+/// @brief The number of files that filesystem_write_file_cached can hold in RAM at once.
+#define FILESYSTEM_CACHE_SLOTS 4
+/// @brief Files larger than this are written straight through by filesystem_write_file_cached.
+#define FILESYSTEM_CACHE_MAX_FILE_SIZE 2048
+/// @brief Files with longer names than this are written straight through by filesystem_write_file_cached.
+#define FILESYSTEM_CACHE_MAX_NAME_LENGTH 23
+/// @brief How long a cached write may stay in RAM, in seconds, before filesystem_flush_if_stale writes it out.
+#define FILESYSTEM_CACHE_DIRTY_TIMEOUT 60
+
+/** @brief Files whose names start with this live on the sensor board's SPI flash instead of the internal storage.
+  * @details This is only available in builds made with EXTERNAL_FLASH=1, on a sensor board that has a flash chip.
+  *          The volume is formatted the first time it's mounted if it doesn't hold a filesystem, so don't use it
+  *          alongside the accelerometer data acquisition face, which uses the flash directly.
+  */
+#define FILESYSTEM_EXTERNAL_PREFIX "ext/"
+/// @brief How many 256 byte pages of the external flash to keep in RAM.
+#define FILESYSTEM_EXTERNAL_CACHE_PAGES 4
+
+/// @brief How many file and owner pairs the I/O statistics for the fsstat command can keep track of.
+#define FILESYSTEM_STATS_ENTRIES 8
+/// @brief Longer file names are truncated in the I/O statistics.
+#define FILESYSTEM_STATS_MAX_NAME_LENGTH 12
+/// @brief Owners for I/O that isn't on behalf of a watch face. @see filesystem_set_stats_owner
+#define FILESYSTEM_STATS_OWNER_SHELL 0xFE
+#define FILESYSTEM_STATS_OWNER_NONE 0xFF
+
+/// @brief State for reading a file one line at a time. @see filesystem_line_reader_open
+typedef struct {
+    filesystem_file_t *file;
+    int32_t position;       // offset in the file of the next unread byte
+    int32_t line_offset;    // offset in the file where the line most recently returned started
+    uint8_t start;          // next unread byte in buf
+    uint8_t end;            // one past the last valid byte in buf
+    char buf[FILESYSTEM_LINE_READER_BUFFER_SIZE];
+} filesystem_line_reader_t;
+
 /** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be.
+  * @details You don't need to call this: the other filesystem functions mount the filesystem the first
+  *          time they need it. It's here for code that wants to pay that cost at a time of its choosing.
   * @return true if the filesystem was mounted successfully.
   */
 bool filesystem_init(void);
 
+/** @brief Returns how long mounting the filesystem took, for the boot time breakdown.
+  * @return the time in microseconds if it was mounted during boot, 0 if it was mounted after boot,
+  *         or -1 if nothing has needed it yet.
+  */
+int32_t filesystem_get_mount_time(void);
+
+/** @brief Returns true once the filesystem is known to have nothing in the rows that belong to the key-value
+  *        store. A filesystem made by older firmware may still be using them; it's left as it is until it isn't,
+  *        or until it is formatted, and the key-value store stays off until then.
+  */
+bool filesystem_kvstore_rows_free(void);
+
 /** @brief Gets the space available on the filesystem.
+  * @details The result is cached until the next time anything is written to flash, so this is cheap
+  *          to call before every write, i.e. to check that a log entry will fit.
   * @return the free space in bytes
   */
 int32_t filesystem_get_free_space(void);
@@ -77,9 +144,74 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   *               to reflect the offset of the next line.
   * @param length The maximum number of bytes to read
   * @return true if the read was successful; false otherwise
+  * @note This opens and closes the file for every line. To read a whole file line by line, use
+  *       filesystem_line_reader_open and filesystem_line_reader_next, which only open it once.
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/** @brief Opens a file and keeps it open, so that you can read or write it in several calls.
+  * @param filename the file you wish to open
+  * @param mode FILESYSTEM_MODE_READ, FILESYSTEM_MODE_WRITE or FILESYSTEM_MODE_APPEND
+  * @return a handle to the open file, or NULL if the file could not be opened (for example, if it doesn't
+  *         exist in read mode, or FILESYSTEM_MAX_OPEN_FILES files are already open).
+  * @note Close the file with filesystem_close when you are done with it, and don't keep it open across
+  *       events: other faces may want to use the filesystem too.
+  */
+filesystem_file_t *filesystem_open(char *filename, filesystem_mode_t mode);
+
+/** @brief Reads from the current position in an open file.
+  * @param file a file opened with filesystem_open
+  * @param buf A buffer of at least length bytes
+  * @param length The maximum number of bytes to read
+  * @return the number of bytes read, which is 0 at the end of the file, or a negative number on error.
+  */
+int32_t filesystem_read(filesystem_file_t *file, void *buf, int32_t length);
+
+/** @brief Writes to the current position in an open file.
+  * @param file a file opened with filesystem_open in FILESYSTEM_MODE_WRITE or FILESYSTEM_MODE_APPEND
+  * @param buf The bytes to write
+  * @param length The number of bytes to write
+  * @return the number of bytes written, or a negative number on error.
+  */
+int32_t filesystem_write(filesystem_file_t *file, const void *buf, int32_t length);
+
+/** @brief Moves the current position in an open file.
+  * @param file a file opened with filesystem_open
+  * @param offset The new position, in bytes from the start of the file
+  * @return the new position, or a negative number on error.
+  */
+int32_t filesystem_seek(filesystem_file_t *file, int32_t offset);
+
+/** @brief Closes a file opened with filesystem_open, writing out any pending changes.
+  * @param file a file opened with filesystem_open
+  * @return true if the file was closed successfully; false otherwise
+  */
+bool filesystem_close(filesystem_file_t *file);
+
+/** @brief Opens a file for reading one line at a time.
+  * @param reader The reader's state, which you provide.
+  * @param filename the file you wish to read
+  * @return true if the file was opened; false otherwise
+  * @note The reader holds one of the FILESYSTEM_MAX_OPEN_FILES open files until you call
+  *       filesystem_line_reader_close.
+  */
+bool filesystem_line_reader_open(filesystem_line_reader_t *reader, char *filename);
+
+/** @brief Reads the next line from a file opened with filesystem_line_reader_open.
+  * @param reader The reader's state.
+  * @param line A buffer of at least length bytes; the line will be read into this buffer without its
+  *             newline, and null terminated. If the line is too long, the rest of it is skipped.
+  * @param length The size of the line buffer
+  * @return true if a line was read; false at the end of the file, or on error.
+  * @note After this returns, reader->line_offset holds the offset in the file where the line started.
+  */
+bool filesystem_line_reader_next(filesystem_line_reader_t *reader, char *line, int32_t length);
+
+/** @brief Closes a file opened with filesystem_line_reader_open.
+  * @param reader The reader's state.
+  */
+void filesystem_line_reader_close(filesystem_line_reader_t *reader);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
@@ -88,6 +220,38 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
   */
 bool filesystem_write_file(char *filename, char *text, int32_t length);
 
+/** @brief Writes a small file to RAM, and to the filesystem later.
+  * @details Every filesystem_write_file is a littlefs commit, which programs (and sooner or later erases) a row
+  *          of flash. Faces that save their state often can use this function instead: repeated writes to the
+  *          same file replace each other in RAM, and only the last one is written out. Movement flushes the
+  *          cache when a face resigns, before entering low energy mode, and once a write has been waiting for
+  *          FILESYSTEM_CACHE_DIRTY_TIMEOUT seconds. The other functions in this file see cached writes as if
+  *          they had already been written.
+  * @param filename the file you wish to write
+  * @param text The contents of the file
+  * @param length The number of bytes to write
+  * @return true if the write was cached or written successfully; false otherwise
+  * @note If the watch resets before the flush, the cached write is lost, but the file on flash is still
+  *       intact: littlefs commits whole files atomically, so it holds either the old contents or the new.
+  */
+bool filesystem_write_file_cached(char *filename, char *text, int32_t length);
+
+/** @brief Writes out every file waiting in the write cache.
+  * @return true if all cached files were written successfully; false otherwise
+  */
+bool filesystem_flush(void);
+
+/** @brief Writes out cached files that have been waiting longer than FILESYSTEM_CACHE_DIRTY_TIMEOUT.
+  * @note This is cheap to call when nothing is cached; Movement calls it once a second.
+  */
+void filesystem_flush_if_stale(void);
+
+/** @brief Lets the storage hardware power down until the next time it's needed.
+  * @details Only the external flash has anything to do here: it goes into deep power-down, and wakes up again on
+  *          the next access. Movement calls this whenever the watch is about to go to sleep.
+  */
+void filesystem_sleep(void);
+
 /** @brief Appends text to file on the filesystem
   * @param filename the file you wish to write
   * @param text The contents to write
@@ -96,11 +260,19 @@ bool filesystem_write_file(char *filename, char *text, int32_t length);
   */
 bool filesystem_append_file(char *filename, char *text, int32_t length);
 
+/** @brief Sets who subsequent flash I/O is charged to in the fsstat table. Movement sets this to the index of
+  *        each watch face before calling into it.
+  * @param owner A watch face index, FILESYSTEM_STATS_OWNER_SHELL or FILESYSTEM_STATS_OWNER_NONE.
+  * @return the previous owner, so that you can put it back.
+  */
+uint8_t filesystem_set_stats_owner(uint8_t owner);
+
 int filesystem_cmd_ls(int argc, char *argv[]);
 int filesystem_cmd_cat(int argc, char *argv[]);
 int filesystem_cmd_df(int argc, char *argv[]);
 int filesystem_cmd_rm(int argc, char *argv[]);
 int filesystem_cmd_format(int argc, char *argv[]);
 int filesystem_cmd_echo(int argc, char *argv[]);
+int filesystem_cmd_fsstat(int argc, char *argv[]);
 
 #endif // FILESYSTEM_H_
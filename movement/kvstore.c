@@ -0,0 +1,380 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "kvstore.h"
+#include "filesystem.h"
+#include "watch.h"
+
+#define KVSTORE_VERSION 1
+#define KVSTORE_FIRST_ROW (NVMCTRL_RWWEE_PAGES / 4 - KVSTORE_ROWS)
+#define KVSTORE_BANK_ROWS (KVSTORE_ROWS / 2)
+#define KVSTORE_BANK_SIZE (KVSTORE_BANK_ROWS * NVMCTRL_ROW_SIZE)
+#define KVSTORE_HEADER_SIZE 8
+#define KVSTORE_TRANSACTION_HEADER_SIZE 4
+#define KVSTORE_RECORD_HEADER_SIZE 3
+#define KVSTORE_CRC_SIZE 2
+
+#define KVSTORE_TRANSACTION 'T'
+#define KVSTORE_PUT 'P'
+#define KVSTORE_DELETE 'D'
+
+// twice as many slots as keys, so probe sequences stay short and there's always an empty slot to stop at.
+#define KVSTORE_INDEX_SIZE (KVSTORE_MAX_KEYS * 2)
+#define KVSTORE_INDEX_EMPTY 0xFFFF
+#define KVSTORE_INDEX_DELETED 0xFFFE
+
+static struct {
+    bool mounted;
+    bool in_transaction;
+    bool transaction_failed;        // something didn't fit, so the whole transaction has to fail
+    uint8_t bank;                   // the active bank, 0 or 1
+    uint8_t keys;                   // number of keys in the index
+    uint16_t end;                   // offset in the active bank where the next transaction goes
+    uint32_t sequence;              // the active bank's sequence number
+    uint16_t index[KVSTORE_INDEX_SIZE]; // offset in the active bank of each key's record
+    uint16_t transaction_length;    // bytes of records in transaction
+    uint8_t transaction[KVSTORE_MAX_TRANSACTION_SIZE];
+} kv;
+
+static inline uint16_t _kvstore_align(uint16_t offset) {
+    return (offset + NVMCTRL_PAGE_SIZE - 1) & ~(NVMCTRL_PAGE_SIZE - 1);
+}
+
+static uint16_t _kvstore_crc(uint16_t crc, const uint8_t *data, uint16_t length) {
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static uint8_t _kvstore_hash(const char *key, uint8_t key_length) {
+    uint16_t hash = 0x811C;
+    for (uint8_t i = 0; i < key_length; i++) hash = (hash ^ (uint8_t)key[i]) * 0x0193;
+    return (hash ^ (hash >> 8)) % KVSTORE_INDEX_SIZE;
+}
+
+static bool _kvstore_read(uint8_t bank, uint16_t offset, void *buffer, uint16_t size) {
+    return watch_storage_read(KVSTORE_FIRST_ROW + bank * KVSTORE_BANK_ROWS, offset, buffer, size);
+}
+
+// CRC of size bytes of a bank, read a page at a time so that we don't need a buffer the size of a transaction.
+static uint16_t _kvstore_crc_bank(uint8_t bank, uint16_t offset, uint16_t size) {
+    uint8_t buf[NVMCTRL_PAGE_SIZE];
+    uint16_t crc = 0xFFFF;
+    while (size) {
+        uint16_t chunk = size < sizeof(buf) ? size : sizeof(buf);
+        if (!_kvstore_read(bank, offset, buf, chunk)) return ~crc;
+        crc = _kvstore_crc(crc, buf, chunk);
+        offset += chunk;
+        size -= chunk;
+    }
+    return crc;
+}
+
+/// @return the index slot holding key, or the empty slot where it would go; or -1 if it isn't there and the index is full.
+static int16_t _kvstore_find(const char *key, uint8_t key_length, bool *found) {
+    int16_t free_slot = -1;
+    uint8_t slot = _kvstore_hash(key, key_length);
+    *found = false;
+
+    for (uint8_t probes = 0; probes < KVSTORE_INDEX_SIZE; probes++, slot = (slot + 1) % KVSTORE_INDEX_SIZE) {
+        uint16_t offset = kv.index[slot];
+        if (offset == KVSTORE_INDEX_EMPTY) return free_slot >= 0 ? free_slot : slot;
+        if (offset == KVSTORE_INDEX_DELETED) {
+            if (free_slot < 0) free_slot = slot;
+            continue;
+        }
+        uint8_t header[KVSTORE_RECORD_HEADER_SIZE];
+        char stored_key[KVSTORE_MAX_KEY_LENGTH];
+        _kvstore_read(kv.bank, offset, header, sizeof(header));
+        if (header[1] != key_length) continue;
+        _kvstore_read(kv.bank, offset + KVSTORE_RECORD_HEADER_SIZE, stored_key, key_length);
+        if (memcmp(stored_key, key, key_length) == 0) {
+            *found = true;
+            return slot;
+        }
+    }
+
+    return free_slot;
+}
+
+// applies the records of a transaction that has passed its CRC check to the index.
+static void _kvstore_apply(uint16_t offset, uint16_t length) {
+    uint16_t end = offset + length;
+    while (offset + KVSTORE_RECORD_HEADER_SIZE <= end) {
+        uint8_t header[KVSTORE_RECORD_HEADER_SIZE];
+        char key[KVSTORE_MAX_KEY_LENGTH];
+        _kvstore_read(kv.bank, offset, header, sizeof(header));
+        if (header[1] > KVSTORE_MAX_KEY_LENGTH) return;
+        _kvstore_read(kv.bank, offset + KVSTORE_RECORD_HEADER_SIZE, key, header[1]);
+
+        bool found;
+        int16_t slot = _kvstore_find(key, header[1], &found);
+        if (header[0] == KVSTORE_PUT && slot >= 0) {
+            if (!found) kv.keys++;
+            kv.index[slot] = offset;
+        } else if (header[0] == KVSTORE_DELETE && found) {
+            kv.keys--;
+            kv.index[slot] = KVSTORE_INDEX_DELETED;
+        }
+        offset += KVSTORE_RECORD_HEADER_SIZE + header[1] + header[2];
+    }
+}
+
+/// @brief Rebuilds the index from a bank, and finds where the next transaction goes.
+/// @return true if the bank has a valid header and at least one valid transaction.
+static bool _kvstore_replay(uint8_t bank) {
+    uint8_t header[KVSTORE_HEADER_SIZE];
+    if (!_kvstore_read(bank, 0, header, sizeof(header))) return false;
+    if (header[0] != 'K' || header[1] != 'V' || header[2] != KVSTORE_VERSION) return false;
+
+    kv.bank = bank;
+    kv.sequence = header[4] | (header[5] << 8) | ((uint32_t)header[6] << 16) | ((uint32_t)header[7] << 24);
+    kv.keys = 0;
+    memset(kv.index, 0xFF, sizeof(kv.index));
+
+    bool valid = false;
+    uint16_t offset = KVSTORE_HEADER_SIZE;
+    while (offset + KVSTORE_TRANSACTION_HEADER_SIZE + KVSTORE_CRC_SIZE <= KVSTORE_BANK_SIZE) {
+        uint8_t transaction[KVSTORE_TRANSACTION_HEADER_SIZE];
+        _kvstore_read(bank, offset, transaction, sizeof(transaction));
+        // transactions are written in order, so an erased page is the end of the log.
+        if (transaction[0] == 0xFF) break;
+
+        uint16_t length = transaction[2] | (transaction[3] << 8);
+        uint32_t size = KVSTORE_TRANSACTION_HEADER_SIZE + length;
+        if (transaction[0] == KVSTORE_TRANSACTION && offset + size + KVSTORE_CRC_SIZE <= KVSTORE_BANK_SIZE) {
+            uint8_t stored_crc[KVSTORE_CRC_SIZE];
+            _kvstore_read(bank, offset + size, stored_crc, sizeof(stored_crc));
+            if (_kvstore_crc_bank(bank, offset, size) == (stored_crc[0] | (stored_crc[1] << 8))) {
+                _kvstore_apply(offset + KVSTORE_TRANSACTION_HEADER_SIZE, length);
+                valid = true;
+            }
+            offset = _kvstore_align(offset + size + KVSTORE_CRC_SIZE);
+        } else {
+            // garbage from an interrupted write. the next transaction starts on the next page.
+            offset = _kvstore_align(offset + 1);
+        }
+    }
+    kv.end = offset;
+
+    return valid;
+}
+
+/// @brief Writes a transaction to the active bank, a page at a time, and adds it to the index.
+/// @param prefix Written first, in the same page; used for the bank header when compacting.
+static bool _kvstore_write(const uint8_t *prefix, uint8_t prefix_length, const uint8_t *records, uint16_t length) {
+    uint16_t start = kv.end + prefix_length;
+    uint16_t total = prefix_length + KVSTORE_TRANSACTION_HEADER_SIZE + length + KVSTORE_CRC_SIZE;
+    if (kv.end + total > KVSTORE_BANK_SIZE) return false;
+
+    uint8_t header[KVSTORE_TRANSACTION_HEADER_SIZE] = {KVSTORE_TRANSACTION, 0, length & 0xFF, length >> 8};
+    uint16_t crc = _kvstore_crc(0xFFFF, header, sizeof(header));
+    crc = _kvstore_crc(crc, records, length);
+    uint8_t footer[KVSTORE_CRC_SIZE] = {crc & 0xFF, crc >> 8};
+
+    uint8_t page[NVMCTRL_PAGE_SIZE];
+    for (uint16_t position = 0; position < total; position += NVMCTRL_PAGE_SIZE) {
+        memset(page, 0xFF, sizeof(page));
+        for (uint16_t i = 0; i < NVMCTRL_PAGE_SIZE && position + i < total; i++) {
+            uint16_t j = position + i;
+            if (j < prefix_length) page[i] = prefix[j];
+            else if ((j -= prefix_length) < sizeof(header)) page[i] = header[j];
+            else if ((j -= sizeof(header)) < length) page[i] = records[j];
+            else page[i] = footer[j - length];
+        }
+        if (!watch_storage_write(KVSTORE_FIRST_ROW + kv.bank * KVSTORE_BANK_ROWS, kv.end + position, page, sizeof(page))) return false;
+    }
+    watch_storage_sync();
+
+    kv.end = _kvstore_align(kv.end + total);
+    _kvstore_apply(start + KVSTORE_TRANSACTION_HEADER_SIZE, length);
+
+    return true;
+}
+
+/// @brief Copies every live record into a single transaction at the start of the other bank.
+/// @param reserve Bytes that must be free in the new bank afterwards, for the transaction that prompted this.
+static bool _kvstore_compact(uint16_t reserve) {
+    uint8_t *records = malloc(KVSTORE_BANK_SIZE);
+    if (records == NULL) return false;
+
+    uint16_t length = 0;
+    for (uint8_t slot = 0; slot < KVSTORE_INDEX_SIZE; slot++) {
+        uint16_t offset = kv.index[slot];
+        if (offset >= KVSTORE_INDEX_DELETED) continue;
+        uint8_t header[KVSTORE_RECORD_HEADER_SIZE];
+        _kvstore_read(kv.bank, offset, header, sizeof(header));
+        uint16_t size = KVSTORE_RECORD_HEADER_SIZE + header[1] + header[2];
+        if (length + size > KVSTORE_BANK_SIZE) {
+            free(records);
+            return false;
+        }
+        _kvstore_read(kv.bank, offset, records + length, size);
+        length += size;
+    }
+
+    uint16_t needed = _kvstore_align(KVSTORE_HEADER_SIZE + KVSTORE_TRANSACTION_HEADER_SIZE + length + KVSTORE_CRC_SIZE) + reserve;
+    if (needed > KVSTORE_BANK_SIZE) {
+        free(records);
+        return false;
+    }
+
+    uint8_t bank = kv.bank ^ 1;
+    for (uint8_t row = 0; row < KVSTORE_BANK_ROWS; row++) {
+        watch_storage_erase(KVSTORE_FIRST_ROW + bank * KVSTORE_BANK_ROWS + row);
+    }
+
+    // the old bank stays as it is until the next compaction; until this one is written, it's still the valid one.
+    uint32_t sequence = kv.sequence + 1;
+    uint8_t header[KVSTORE_HEADER_SIZE] = {'K', 'V', KVSTORE_VERSION, 0, sequence & 0xFF, (sequence >> 8) & 0xFF, (sequence >> 16) & 0xFF, sequence >> 24};
+    kv.bank = bank;
+    kv.sequence = sequence;
+    kv.end = 0;
+    kv.keys = 0;
+    memset(kv.index, 0xFF, sizeof(kv.index));
+    bool ok = _kvstore_write(header, sizeof(header), records, length);
+    free(records);
+
+    // if that failed, the other bank is still intact.
+    if (!ok) kv.mounted = _kvstore_replay(bank ^ 1);
+
+    return ok;
+}
+
+static bool _kvstore_mount(void) {
+    if (kv.mounted) return true;
+
+    uint8_t headers[2][KVSTORE_HEADER_SIZE];
+    uint32_t sequences[2];
+    for (uint8_t bank = 0; bank < 2; bank++) {
+        _kvstore_read(bank, 0, headers[bank], KVSTORE_HEADER_SIZE);
+        sequences[bank] = headers[bank][4] | (headers[bank][5] << 8) | ((uint32_t)headers[bank][6] << 16) | ((uint32_t)headers[bank][7] << 24);
+    }
+
+    // try the newer bank first; if a compaction was interrupted, it won't be valid, and the older one will be.
+    uint8_t newer = sequences[1] > sequences[0] ? 1 : 0;
+    if (_kvstore_replay(newer) || _kvstore_replay(newer ^ 1)) {
+        kv.mounted = true;
+        return true;
+    }
+
+    // nothing here. these rows may still hold part of a filesystem from before the key-value store existed;
+    // if they do, stay off rather than erase them.
+    if (!filesystem_kvstore_rows_free()) return false;
+    kv.bank = 1;
+    kv.sequence = 0;
+    kv.keys = 0;
+    memset(kv.index, 0xFF, sizeof(kv.index));
+    kv.mounted = _kvstore_compact(0);
+
+    return kv.mounted;
+}
+
+static bool _kvstore_queue(uint8_t type, const char *key, const void *value, uint8_t length) {
+    size_t key_length = strlen(key);
+    uint16_t size = KVSTORE_RECORD_HEADER_SIZE + key_length + length;
+    if (key_length == 0 || key_length > KVSTORE_MAX_KEY_LENGTH || length > KVSTORE_MAX_VALUE_LENGTH ||
+        kv.transaction_length + size > KVSTORE_MAX_TRANSACTION_SIZE) {
+        kv.transaction_failed = kv.in_transaction;
+        return false;
+    }
+
+    uint8_t *record = kv.transaction + kv.transaction_length;
+    record[0] = type;
+    record[1] = key_length;
+    record[2] = length;
+    memcpy(record + KVSTORE_RECORD_HEADER_SIZE, key, key_length);
+    if (length) memcpy(record + KVSTORE_RECORD_HEADER_SIZE + key_length, value, length);
+    kv.transaction_length += size;
+
+    return kv.in_transaction || kvstore_commit();
+}
+
+int16_t kvstore_get(const char *key, void *value, uint8_t length) {
+    size_t key_length = strlen(key);
+    if (key_length > KVSTORE_MAX_KEY_LENGTH || !_kvstore_mount()) return -1;
+
+    bool found;
+    int16_t slot = _kvstore_find(key, key_length, &found);
+    if (!found) return -1;
+
+    uint16_t offset = kv.index[slot];
+    uint8_t header[KVSTORE_RECORD_HEADER_SIZE];
+    _kvstore_read(kv.bank, offset, header, sizeof(header));
+    uint8_t size = header[2] < length ? header[2] : length;
+    if (size) _kvstore_read(kv.bank, offset + KVSTORE_RECORD_HEADER_SIZE + key_length, value, size);
+
+    return header[2];
+}
+
+bool kvstore_put(const char *key, const void *value, uint8_t length) {
+    return _kvstore_queue(KVSTORE_PUT, key, value, length);
+}
+
+bool kvstore_delete(const char *key) {
+    return _kvstore_queue(KVSTORE_DELETE, key, NULL, 0);
+}
+
+void kvstore_begin(void) {
+    kv.in_transaction = true;
+    kv.transaction_failed = false;
+    kv.transaction_length = 0;
+}
+
+bool kvstore_commit(void) {
+    uint16_t length = kv.transaction_length;
+    bool failed = kv.transaction_failed;
+    kv.in_transaction = false;
+    kv.transaction_failed = false;
+    kv.transaction_length = 0;
+    if (failed) return false;
+    if (length == 0) return true;
+    if (!_kvstore_mount()) return false;
+
+    // make sure there's room in the index for any new keys. this is conservative: it counts
+    // every put of a key that isn't there yet, even if the same transaction deletes it again.
+    uint8_t new_keys = 0;
+    for (uint16_t offset = 0; offset < length; offset += KVSTORE_RECORD_HEADER_SIZE + kv.transaction[offset + 1] + kv.transaction[offset + 2]) {
+        bool found;
+        if (kv.transaction[offset] != KVSTORE_PUT) continue;
+        _kvstore_find((const char *)kv.transaction + offset + KVSTORE_RECORD_HEADER_SIZE, kv.transaction[offset + 1], &found);
+        if (!found) new_keys++;
+    }
+    if (kv.keys + new_keys > KVSTORE_MAX_KEYS) return false;
+
+    uint16_t size = _kvstore_align(KVSTORE_TRANSACTION_HEADER_SIZE + length + KVSTORE_CRC_SIZE);
+    if (kv.end + size > KVSTORE_BANK_SIZE && !_kvstore_compact(size)) return false;
+
+    return _kvstore_write(NULL, 0, kv.transaction, length);
+}
+
+void kvstore_abort(void) {
+    kv.in_transaction = false;
+    kv.transaction_failed = false;
+    kv.transaction_length = 0;
+}
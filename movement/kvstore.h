@@ -0,0 +1,97 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef KVSTORE_H_
+#define KVSTORE_H_
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * A small key-value store for settings and saved state, for things that are too small to deserve a file.
+ *
+ * It lives in the last KVSTORE_ROWS rows of the RWWEE storage area (the filesystem gets the rest), split into
+ * two banks. Changes are appended to the active bank as transactions; each one is a header with its length,
+ * one or more put or delete records, and a CRC over the whole thing. A transaction starts on a page boundary
+ * and is written a page at a time, so a change costs one or two page writes, and one that was interrupted by
+ * a reset fails its CRC and is skipped. When the active bank fills up, the live values are copied to the other
+ * bank as a single transaction, which is the only time the store erases anything. A bank is only a few pages,
+ * though, so that happens often: counting pages, 100 puts of a small value erase about 32 rows. That's
+ * arithmetic, not a measurement, and it hasn't been compared with littlefs or timed on a watch.
+ *
+ * A filesystem made by older firmware may still have blocks in these rows, in which case every call here
+ * fails until it doesn't; see filesystem_kvstore_rows_free.
+ *
+ * At mount, the active bank is replayed into a hash table in RAM that maps each key to the offset of its
+ * value in flash, so a get is one probe and a memcpy out of flash.
+ *
+ * Layout of a bank: an 8 byte header ('K', 'V', version, 0, 32-bit little-endian sequence number; the valid
+ * bank with the higher sequence number is the active one), followed by transactions. A transaction is
+ * 'T', 0, 16-bit length of the records, the records, and a 16-bit CRC-CCITT of everything before it.
+ * A record is type ('P' or 'D'), key length, value length, the key, and the value.
+ */
+
+#define KVSTORE_ROWS 4
+#define KVSTORE_MAX_KEY_LENGTH 15
+#define KVSTORE_MAX_VALUE_LENGTH 64
+#define KVSTORE_MAX_KEYS 32
+#define KVSTORE_MAX_TRANSACTION_SIZE 192
+
+/** @brief Reads a value from the store.
+  * @param key The key, at most KVSTORE_MAX_KEY_LENGTH characters.
+  * @param value Receives up to length bytes of the value.
+  * @param length The size of the value buffer.
+  * @return The length of the stored value, which may be more than length; or -1 if the key isn't there.
+  * @note Changes in an open transaction aren't visible until it is committed.
+  */
+int16_t kvstore_get(const char *key, void *value, uint8_t length);
+
+/** @brief Stores a value, replacing any previous value for the key.
+  * @param key The key, at most KVSTORE_MAX_KEY_LENGTH characters.
+  * @param value The value to store.
+  * @param length The length of the value, at most KVSTORE_MAX_VALUE_LENGTH bytes.
+  * @return true if the value was stored (or, in a transaction, queued); false otherwise.
+  */
+bool kvstore_put(const char *key, const void *value, uint8_t length);
+
+/** @brief Removes a key from the store.
+  * @param key The key to remove.
+  * @return true if the key was removed (or, in a transaction, the removal was queued), or wasn't there.
+  */
+bool kvstore_delete(const char *key);
+
+/** @brief Starts a transaction: puts and deletes are held in RAM until kvstore_commit, and then either all of
+  *        them make it to flash or none of them do. A transaction holds at most KVSTORE_MAX_TRANSACTION_SIZE
+  *        bytes of records; each record takes three bytes plus the key and value.
+  */
+void kvstore_begin(void);
+
+/** @brief Writes an open transaction to flash.
+  * @return true if every change in it was stored; false if none were.
+  */
+bool kvstore_commit(void);
+
+/** @brief Throws away an open transaction. */
+void kvstore_abort(void);
+
+#endif // KVSTORE_H_
@@ -74,15 +74,82 @@ double astro_convert_date_to_julian_date(uint16_t year, uint8_t month, uint8_t d
 //The positions are adjusted for the parallax of the Earth, and the offset of the observer from the Earth's center
 //All input and output angles are in radians!
 astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t body, double lat, double lon, bool calculate_precession) {
-    double jdTT = astro_convert_utc_to_tt(jd);
-    double t = astro_convert_jd_to_julian_millenia_since_j2000(jdTT);
-    
-    // Get current position of Earth and the target body
-    astro_cartesian_coordinates_t earth_coords = astro_get_body_coordinates(ASTRO_BODY_EARTH, t);
-    astro_cartesian_coordinates_t body_coords = astro_get_body_coordinates_light_time_adjusted(body, earth_coords, t);
+    astro_ra_dec_state_t state;
+
+    astro_ra_dec_begin(&state, jd, body);
+    while (!astro_ra_dec_step(&state, UINT8_MAX));
+
+    return astro_ra_dec_finish(&state, lat, lon, calculate_precession);
+}
+
+void astro_ra_dec_begin(astro_ra_dec_state_t *state, double jd, astro_body_t body) {
+    state->jd = jd;
+    state->jdTT = astro_convert_utc_to_tt(jd);
+    state->t = astro_convert_jd_to_julian_millenia_since_j2000(state->jdTT);
+    state->light_time_t = state->t;
+    state->light_time_iteration = 0;
+    state->body = body;
+    state->steps_done = 0;
+    // Earth, then the body, then the body twice more adjusted for light time.
+    state->steps_total = astro_body_coordinates_num_steps(ASTRO_BODY_EARTH) + 3 * astro_body_coordinates_num_steps(body);
+    state->stage = ASTRO_RA_DEC_STAGE_EARTH;
+    astro_body_coordinates_begin(&state->body_state, ASTRO_BODY_EARTH, state->t);
+}
 
+static void _astro_ra_dec_advance(astro_ra_dec_state_t *state) {
+    switch (state->stage) {
+        case ASTRO_RA_DEC_STAGE_EARTH:
+            // Got the current position of Earth, move on to the target body
+            state->earth_coords = astro_body_coordinates_result(&state->body_state);
+            state->stage = ASTRO_RA_DEC_STAGE_BODY;
+            astro_body_coordinates_begin(&state->body_state, state->body, state->t);
+            break;
+        case ASTRO_RA_DEC_STAGE_BODY:
+            state->body_coords = astro_body_coordinates_result(&state->body_state);
+            if (state->light_time_iteration == 2) {
+                state->stage = ASTRO_RA_DEC_STAGE_DONE;
+                break;
+            }
+            {
+                //Calculate light time to body
+                astro_cartesian_coordinates_t relative = astro_subtract_cartesian(state->body_coords, state->earth_coords);
+                double distance = sqrt(relative.x*relative.x + relative.y*relative.y + relative.z*relative.z);
+                distance *= 1.496e+11; //Convert from AU to meters
+                double lightTime = distance / 299792458.0;
+
+                //Convert light time to Julian Millenia, and subtract it from the original value of t
+                state->light_time_t -= lightTime / 24.0 / 60.0 / 60.0 / 365250.0;
+            }
+            //Recalculate body position adjusted for light time
+            state->light_time_iteration++;
+            astro_body_coordinates_begin(&state->body_state, state->body, state->light_time_t);
+            break;
+        case ASTRO_RA_DEC_STAGE_DONE:
+            break;
+    }
+}
+
+bool astro_ra_dec_step(astro_ra_dec_state_t *state, uint8_t budget) {
+    while (state->stage != ASTRO_RA_DEC_STAGE_DONE) {
+        if (state->body_state.series < astro_body_coordinates_num_steps(state->body_state.body)) {
+            if (budget == 0) return false;
+            budget--;
+            state->steps_done++;
+        }
+        if (astro_body_coordinates_step(&state->body_state)) _astro_ra_dec_advance(state);
+    }
+
+    return true;
+}
+
+uint8_t astro_ra_dec_progress(const astro_ra_dec_state_t *state) {
+    if (state->steps_total == 0) return 100;
+    return (uint16_t)state->steps_done * 100 / state->steps_total;
+}
+
+astro_equatorial_coordinates_t astro_ra_dec_finish(const astro_ra_dec_state_t *state, double lat, double lon, bool calculate_precession) {
     // Convert to Geocentric coordinate
-    body_coords = astro_subtract_cartesian(body_coords, earth_coords);
+    astro_cartesian_coordinates_t body_coords = astro_subtract_cartesian(state->body_coords, state->earth_coords);
 
     //Rotate ecliptic coordinates to J2000 coordinates
     body_coords = astro_rotate_from_vsop_to_J2000(body_coords);
@@ -90,12 +157,12 @@ astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t body, do
     astro_matrix_t precession;
     // TODO: rotate body for precession, nutation and bias
     if(calculate_precession) {
-        precession = astro_get_precession_matrix(jdTT);
+        precession = astro_get_precession_matrix(state->jdTT);
         body_coords = astro_matrix_multiply(body_coords, precession);
     }
 
     //Convert to topocentric
-    astro_cartesian_coordinates_t observerXYZ = astro_get_observer_geocentric_coords(jdTT, lat, lon);
+    astro_cartesian_coordinates_t observerXYZ = astro_get_observer_geocentric_coords(state->jdTT, lat, lon);
 
     if(calculate_precession) {
         //TODO: rotate observerXYZ for precession, nutation and bias
@@ -457,6 +524,74 @@ astro_cartesian_coordinates_t astro_get_body_coordinates(astro_body_t body, doub
     return retval;
 }
 
+typedef double (*astro_vsop87_series_t)(double t);
+
+// The x, y and z series for each body, indexed by astro_body_t. The Sun is always at the origin.
+static const astro_vsop87_series_t _astro_vsop87_series[][3] = {
+    [ASTRO_BODY_SUN] = { NULL, NULL, NULL },
+    [ASTRO_BODY_MERCURY] = { vsop87a_milli_mercury_x, vsop87a_milli_mercury_y, vsop87a_milli_mercury_z },
+    [ASTRO_BODY_VENUS] = { vsop87a_milli_venus_x, vsop87a_milli_venus_y, vsop87a_milli_venus_z },
+    [ASTRO_BODY_EARTH] = { vsop87a_milli_earth_x, vsop87a_milli_earth_y, vsop87a_milli_earth_z },
+    [ASTRO_BODY_MARS] = { vsop87a_milli_mars_x, vsop87a_milli_mars_y, vsop87a_milli_mars_z },
+    [ASTRO_BODY_JUPITER] = { vsop87a_milli_jupiter_x, vsop87a_milli_jupiter_y, vsop87a_milli_jupiter_z },
+    [ASTRO_BODY_SATURN] = { vsop87a_milli_saturn_x, vsop87a_milli_saturn_y, vsop87a_milli_saturn_z },
+    [ASTRO_BODY_URANUS] = { vsop87a_milli_uranus_x, vsop87a_milli_uranus_y, vsop87a_milli_uranus_z },
+    [ASTRO_BODY_NEPTUNE] = { vsop87a_milli_neptune_x, vsop87a_milli_neptune_y, vsop87a_milli_neptune_z },
+    [ASTRO_BODY_EMB] = { vsop87a_milli_emb_x, vsop87a_milli_emb_y, vsop87a_milli_emb_z },
+    // the Moon is derived from the Earth (series 0-2) and the Earth-Moon barycenter (series 3-5)
+    [ASTRO_BODY_MOON] = { NULL, NULL, NULL },
+};
+
+uint8_t astro_body_coordinates_num_steps(astro_body_t body) {
+    switch (body) {
+        case ASTRO_BODY_SUN:
+            return 0;
+        case ASTRO_BODY_MOON:
+            return 6;
+        default:
+            return 3;
+    }
+}
+
+void astro_body_coordinates_begin(astro_body_coordinates_state_t *state, astro_body_t body, double t) {
+    state->body = body;
+    state->t = t;
+    state->series = 0;
+    state->coords[0] = state->coords[1] = state->coords[2] = 0;
+}
+
+bool astro_body_coordinates_step(astro_body_coordinates_state_t *state) {
+    uint8_t num_steps = astro_body_coordinates_num_steps(state->body);
+    if (state->series >= num_steps) return true;
+
+    if (state->body == ASTRO_BODY_MOON) {
+        if (state->series < 3) state->coords[state->series] = _astro_vsop87_series[ASTRO_BODY_EARTH][state->series](state->t);
+        else state->emb[state->series - 3] = _astro_vsop87_series[ASTRO_BODY_EMB][state->series - 3](state->t);
+    } else {
+        state->coords[state->series] = _astro_vsop87_series[state->body][state->series](state->t);
+    }
+    state->series++;
+
+    return state->series >= num_steps;
+}
+
+astro_cartesian_coordinates_t astro_body_coordinates_result(const astro_body_coordinates_state_t *state) {
+    astro_cartesian_coordinates_t retval;
+    double coords[3] = { state->coords[0], state->coords[1], state->coords[2] };
+
+    if (state->body == ASTRO_BODY_MOON) {
+        double earth_coords[3] = { state->coords[0], state->coords[1], state->coords[2] };
+        double emb_coords[3] = { state->emb[0], state->emb[1], state->emb[2] };
+        vsop87a_milli_getMoon(earth_coords, emb_coords, coords);
+    }
+
+    retval.x = coords[0];
+    retval.y = coords[1];
+    retval.z = coords[2];
+
+    return retval;
+}
+
 astro_cartesian_coordinates_t astro_get_body_coordinates_light_time_adjusted(astro_body_t body, astro_cartesian_coordinates_t origin, double t) {
     //Get current position of body
     astro_cartesian_coordinates_t body_coords = astro_get_body_coordinates(body, t);
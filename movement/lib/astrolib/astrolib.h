@@ -66,6 +66,37 @@ typedef struct {
     uint8_t seconds; // you may want this to be a float, watch just can't display any more digits
 } astro_angle_hms_t;
 
+// State for calculating a body's heliocentric position one VSOP87 series at a time.
+typedef struct {
+    astro_body_t body;
+    double t;
+    uint8_t series;     // index of the next series to evaluate
+    double coords[3];
+    double emb[3];      // the Moon also needs the Earth-Moon barycenter
+} astro_body_coordinates_state_t;
+
+typedef enum {
+    ASTRO_RA_DEC_STAGE_EARTH = 0,
+    ASTRO_RA_DEC_STAGE_BODY,
+    ASTRO_RA_DEC_STAGE_DONE
+} astro_ra_dec_stage_t;
+
+// State for a resumable right ascension / declination calculation. @see astro_ra_dec_begin
+typedef struct {
+    astro_body_t body;
+    double jd;
+    double jdTT;
+    double t;
+    double light_time_t;
+    astro_ra_dec_stage_t stage;
+    uint8_t light_time_iteration;
+    uint8_t steps_done;
+    uint8_t steps_total;
+    astro_cartesian_coordinates_t earth_coords;
+    astro_cartesian_coordinates_t body_coords;
+    astro_body_coordinates_state_t body_state;
+} astro_ra_dec_state_t;
+
 // Convert a date to a julian date. Must be in UTC+0 time zone!
 double astro_convert_date_to_julian_date(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second);
 
@@ -75,6 +106,20 @@ double astro_convert_jd_to_julian_millenia_since_j2000(double jd);
 // Get right ascension / declination for a given body in the list above.
 astro_equatorial_coordinates_t astro_get_ra_dec(double jd, astro_body_t bodyNum, double lat, double lon, bool calculate_precession);
 
+// The same calculation, split into steps so that it can be spread over several calls. Each step evaluates one
+// VSOP87 series, which is where nearly all of the time goes. Call astro_ra_dec_begin, then astro_ra_dec_step with
+// a budget of steps until it returns true, then astro_ra_dec_finish for each flavor of result you need.
+void astro_ra_dec_begin(astro_ra_dec_state_t *state, double jd, astro_body_t body);
+bool astro_ra_dec_step(astro_ra_dec_state_t *state, uint8_t budget);
+uint8_t astro_ra_dec_progress(const astro_ra_dec_state_t *state); // 0-100 percent
+astro_equatorial_coordinates_t astro_ra_dec_finish(const astro_ra_dec_state_t *state, double lat, double lon, bool calculate_precession);
+
+// Incremental heliocentric coordinates for a body; astro_body_coordinates_step returns true once complete.
+void astro_body_coordinates_begin(astro_body_coordinates_state_t *state, astro_body_t body, double t);
+bool astro_body_coordinates_step(astro_body_coordinates_state_t *state);
+uint8_t astro_body_coordinates_num_steps(astro_body_t body);
+astro_cartesian_coordinates_t astro_body_coordinates_result(const astro_body_coordinates_state_t *state);
+
 // Convert right ascension / declination to altitude/azimuth for a given location.
 astro_horizontal_coordinates_t astro_ra_dec_to_alt_az(double jd, double lat, double lon, double ra, double dec);
 
@@ -22,25 +22,35 @@
  * SOFTWARE.
  */
 
-#include <stdlib.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 #include "chirpy_tx.h"
 
-static const uint32_t chirpy_min_freq = 2500;
-static const uint32_t cirpy_freq_step = 250;
+// Tone periods for 2500 Hz up to 6500 Hz in 250 Hz steps, i.e. 1_000_000 / freq.
+// The classic mode uses the first 9, and the dense modes all 17.
+static const uint16_t chirpy_tone_periods[] = {
+    400, 363, 333, 307, 285, 266, 250, 235, 222, 210, 200, 190, 181, 173, 166, 160, 153
+};
 
 // This many bytes are followed by a CRC and block separator
 // It's a multiple of 3 so no bits are wasted (a tone encodes 3 bits)
 // Last block can be shorter
 static const uint8_t chirpy_default_block_size = 15;
 
+// In the dense modes, 21 bytes and the CRC make 44 nibbles: exactly 4 Reed-Solomon codewords.
+static const uint8_t chirpy_dense_block_size = 21;
+
 // The dedicated control tone. This is the highest tone index.
 static const uint8_t chirpy_control_tone = 8;
+static const uint8_t chirpy_dense_control_tone = 16;
 
-// Pre-computed tone periods. This is allocated and populated on-demand.
-static uint32_t *chirpy_tone_periods = NULL;
+// Reed-Solomon (15, 11) over GF(16), with x^4 + x + 1 as the field polynomial. The generator polynomial has
+// roots a^0 to a^3: x^4 + 15x^3 + 3x^2 + x + 12, and these are its coefficients below x^4, lowest first.
+#define CHIRPY_RS_DATA_LEN 11
+static const uint8_t chirpy_gf16_exp[15] = {1, 2, 4, 8, 3, 6, 12, 11, 5, 10, 7, 14, 15, 13, 9};
+static const uint8_t chirpy_gf16_log[16] = {0, 0, 1, 4, 2, 8, 5, 10, 3, 14, 9, 7, 6, 13, 11, 12};
+static const uint8_t chirpy_rs_generator[4] = {12, 1, 3, 15};
 
 uint8_t chirpy_crc8(const uint8_t *addr, uint16_t len) {
     uint8_t crc = 0;
@@ -70,13 +80,30 @@ static void _chirpy_append_tone(chirpy_encoder_state_t *ces, uint8_t tone) {
 }
 
 void chirpy_init_encoder(chirpy_encoder_state_t *ces, chirpy_get_next_byte_t get_next_byte) {
+    chirpy_init_encoder_mode(ces, get_next_byte, CHIRPY_MODE_CLASSIC);
+}
+
+void chirpy_init_encoder_mode(chirpy_encoder_state_t *ces, chirpy_get_next_byte_t get_next_byte, chirpy_mode_t mode) {
     memset(ces, 0, sizeof(chirpy_encoder_state_t));
-    ces->block_size = chirpy_default_block_size;
     ces->get_next_byte = get_next_byte;
-    _chirpy_append_tone(ces, 8);
-    _chirpy_append_tone(ces, 0);
-    _chirpy_append_tone(ces, 8);
-    _chirpy_append_tone(ces, 0);
+    ces->mode = mode;
+    if (mode == CHIRPY_MODE_CLASSIC) {
+        ces->block_size = chirpy_default_block_size;
+        _chirpy_append_tone(ces, 8);
+        _chirpy_append_tone(ces, 0);
+        _chirpy_append_tone(ces, 8);
+        _chirpy_append_tone(ces, 0);
+    } else {
+        ces->block_size = chirpy_dense_block_size;
+        _chirpy_append_tone(ces, chirpy_dense_control_tone);
+        _chirpy_append_tone(ces, 0);
+        _chirpy_append_tone(ces, chirpy_dense_control_tone);
+        _chirpy_append_tone(ces, mode == CHIRPY_MODE_DENSE_FEC ? 1 : 0);
+    }
+}
+
+uint8_t chirpy_get_tone_ticks(const chirpy_encoder_state_t *ces) {
+    return ces->mode == CHIRPY_MODE_CLASSIC ? 3 : 2;
 }
 
 static uint8_t _chirpy_retrieve_next_tone(chirpy_encoder_state_t *ces) {
@@ -125,11 +152,74 @@ static void _chirpy_finish_transmission(chirpy_encoder_state_t *ces) {
     _chirpy_append_tone(ces, chirpy_control_tone);
 }
 
+static uint8_t _chirpy_gf16_mul(uint8_t a, uint8_t b) {
+    if (a == 0 || b == 0) return 0;
+    return chirpy_gf16_exp[(chirpy_gf16_log[a] + chirpy_gf16_log[b]) % 15];
+}
+
+static void _chirpy_flush_codeword(chirpy_encoder_state_t *ces) {
+    if (ces->codeword_len == 0) return;
+    // The parity is the remainder of dividing the codeword by the generator, highest power first.
+    for (int8_t i = 3; i >= 0; --i) {
+        _chirpy_append_tone(ces, ces->parity[i]);
+        ces->parity[i] = 0;
+    }
+    ces->codeword_len = 0;
+}
+
+static void _chirpy_append_nibble(chirpy_encoder_state_t *ces, uint8_t nibble) {
+    _chirpy_append_tone(ces, nibble);
+    if (ces->mode != CHIRPY_MODE_DENSE_FEC) return;
+    // Divide by the generator polynomial as the data goes by, like a CRC.
+    uint8_t feedback = nibble ^ ces->parity[3];
+    for (uint8_t i = 3; i > 0; --i)
+        ces->parity[i] = ces->parity[i - 1] ^ _chirpy_gf16_mul(feedback, chirpy_rs_generator[i]);
+    ces->parity[0] = _chirpy_gf16_mul(feedback, chirpy_rs_generator[0]);
+    ++ces->codeword_len;
+    if (ces->codeword_len == CHIRPY_RS_DATA_LEN)
+        _chirpy_flush_codeword(ces);
+}
+
+static void _chirpy_finish_dense_block(chirpy_encoder_state_t *ces) {
+    _chirpy_append_nibble(ces, ces->crc >> 4);
+    _chirpy_append_nibble(ces, ces->crc & 0x0F);
+    _chirpy_flush_codeword(ces);
+    _chirpy_append_tone(ces, chirpy_dense_control_tone);
+    ces->crc = 0;
+    ces->block_len = 0;
+}
+
+static uint8_t _chirpy_get_next_dense_tone(chirpy_encoder_state_t *ces) {
+    if (ces->get_next_byte == 0)
+        return _chirpy_retrieve_next_tone(ces);
+
+    uint8_t next_byte;
+    if (ces->get_next_byte(&next_byte) == 0) {
+        ces->get_next_byte = 0;
+        if (ces->block_len > 0) _chirpy_finish_dense_block(ces);
+        _chirpy_append_tone(ces, chirpy_dense_control_tone);
+        _chirpy_append_tone(ces, chirpy_dense_control_tone);
+        return _chirpy_retrieve_next_tone(ces);
+    }
+
+    _chirpy_append_nibble(ces, next_byte >> 4);
+    _chirpy_append_nibble(ces, next_byte & 0x0F);
+    ++ces->block_len;
+    ces->crc = chirpy_update_crc8(next_byte, ces->crc);
+    if (ces->block_len == ces->block_size)
+        _chirpy_finish_dense_block(ces);
+
+    return _chirpy_retrieve_next_tone(ces);
+}
+
 uint8_t chirpy_get_next_tone(chirpy_encoder_state_t *ces) {
     // If there are tones left in the buffer, keep sending those
     if (ces->tone_pos < ces->tone_count)
         return _chirpy_retrieve_next_tone(ces);
 
+    if (ces->mode != CHIRPY_MODE_CLASSIC)
+        return _chirpy_get_next_dense_tone(ces);
+
     // We know data is over: that means we've wrapped up transmission
     // Just drain tone buffer, and then keep sendig EOB
     if (ces->get_next_byte == 0)
@@ -163,17 +253,8 @@ uint8_t chirpy_get_next_tone(chirpy_encoder_state_t *ces) {
 }
 
 uint16_t chirpy_get_tone_period(uint8_t tone) {
-    // Create pre-computed tone periods array on first use
-    if (chirpy_tone_periods == NULL) {
-      chirpy_tone_periods = malloc((chirpy_control_tone + 1) * sizeof(uint32_t));
-      for (uint8_t i = 0; i < chirpy_control_tone + 1; ++i) {
-        uint32_t freq = chirpy_min_freq + i * cirpy_freq_step;
-        uint16_t period = 1000000 / freq;
-        chirpy_tone_periods[i] = period;
-      }
-    }
-    // Return pre-computed value, but be paranoid about indexing into array
-    if (tone > chirpy_control_tone)
-      tone = chirpy_control_tone;
+    // Be paranoid about indexing into array
+    if (tone > chirpy_dense_control_tone)
+      tone = chirpy_dense_control_tone;
     return chirpy_tone_periods[tone];
 }
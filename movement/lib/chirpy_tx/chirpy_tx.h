@@ -41,6 +41,24 @@ typedef uint8_t (*chirpy_get_next_byte_t)(uint8_t *next_byte);
 
 #define CHIRPY_TONE_BUF_SIZE 16
 
+/** @brief How the data is turned into tones.
+ * @details CHIRPY_MODE_CLASSIC is what the Chirpy receiver decodes: 3 bits to a tone, from 8 data tones and a
+ *          control tone at 2500 to 4500 Hz, a tone every 3 ticks (21 a second), 15 bytes and a CRC to a block.
+ *          CHIRPY_MODE_DENSE uses 16 data tones and a control tone at 2500 to 6500 Hz to carry 4 bits to a tone, a
+ *          tone every 2 ticks (32 a second), and 21 bytes and a CRC to a block: twice as fast.
+ *          CHIRPY_MODE_DENSE_FEC adds a Reed-Solomon code over GF(16) to each block of the dense mode, so every 11
+ *          tones (the last lot in a block can be fewer) are followed by 4 parity tones, and a receiver can fix any
+ *          2 bad tones in each 15. That is still half again as fast as the classic mode.
+ *          The dense modes start with control, 0, control and then 0 (no FEC) or 1 (FEC). Each block is the data a
+ *          nibble to a tone, high nibble first, then the CRC the same way, then the control tone. Two control tones
+ *          end the transmission. test/test_roundtrip.c has a reference decoder.
+ */
+typedef enum {
+    CHIRPY_MODE_CLASSIC = 0,
+    CHIRPY_MODE_DENSE,
+    CHIRPY_MODE_DENSE_FEC,
+} chirpy_mode_t;
+
 // Holds state used by the encoder. Do not manipulate directly.
 typedef struct {
     uint8_t tone_buf[CHIRPY_TONE_BUF_SIZE];
@@ -52,6 +70,9 @@ typedef struct {
     uint16_t bits;
     uint8_t bit_count;
     chirpy_get_next_byte_t get_next_byte;
+    chirpy_mode_t mode;
+    uint8_t codeword_len;
+    uint8_t parity[4];
 } chirpy_encoder_state_t;
 
 /** @brief Iniitializes the encoder state to be used during the transmission.
@@ -60,6 +81,19 @@ typedef struct {
  */
 void chirpy_init_encoder(chirpy_encoder_state_t *ces, chirpy_get_next_byte_t get_next_byte);
 
+/** @brief Like chirpy_init_encoder, for the given mode.
+ * @param ces Pointer to encoder state object to be initialized.
+ * @param get_next_byte Pointer to function that the encoder will call to fetch data byte by byte.
+ * @param mode The modulation to use; chirpy_init_encoder uses CHIRPY_MODE_CLASSIC.
+ */
+void chirpy_init_encoder_mode(chirpy_encoder_state_t *ces, chirpy_get_next_byte_t get_next_byte, chirpy_mode_t mode);
+
+/** @brief Returns how many 64 Hz ticks each tone should last in the encoder's mode.
+ * @param ces Pointer to the encoder state object.
+ * @return The tick_compare value to use in chirpy_tick_state_t.
+ */
+uint8_t chirpy_get_tone_ticks(const chirpy_encoder_state_t *ces);
+
 /** @brief Returns the next tone to be transmitted.
  * @details This function will call the get_next_byte function stored in the encoder state to
  *          retrieve the next byte to be transmitted as needed. As a single byte is encoded as several tones,
@@ -71,7 +105,7 @@ void chirpy_init_encoder(chirpy_encoder_state_t *ces, chirpy_get_next_byte_t get
 uint8_t chirpy_get_next_tone(chirpy_encoder_state_t *ces);
 
 /** @brief Returns the period value for buzzing out a tone.
- * @param tone The tone index, 0 thru 8.
+ * @param tone The tone index, 0 thru 8, or 0 thru 16 in the dense modes.
  * @return The period for the tone's frequency, i.e., 1_000_000 / freq.
  */
 uint16_t chirpy_get_tone_period(uint8_t tone);
@@ -83,7 +117,8 @@ typedef void (*chirpy_tick_fun_t)(void *context);
 /** @brief Creature-comfort struct for use in your chirping code.
  * @details The idea is to handle a tick that happens 64 times per second at the outermost level.
  *          To get to the desired ~20 tones per second, increment a counter and call the actual
- *          transmission ticker when tick_counter reaches tick_compare, with a compare value of 3.
+ *          transmission ticker when tick_counter reaches tick_compare, with a compare value of 3
+ *          (or whatever chirpy_get_tone_ticks returns for the encoder's mode).
  *          seq_pos is for use by the transmission function to keep track of where it is in the data.
  *          The current transmission function is stored in tick_fun. You can have multiple phases
  *          by switching to a different function. E.g., intro countdown first, followed by data chirping.
@@ -0,0 +1,386 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2023 Gabor L Ugray
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Round trip through every mode: encode random data, play the tones as the buzzer's square wave with noise
+// on top, pick out each tone with the Goertzel algorithm, decode, and count what survived. The receiver
+// knows where each tone starts, so this measures the modulation and the coding, not the synchronization a
+// real receiver needs. Build and run it on the host:
+//
+//     gcc -O2 -o test_roundtrip test_roundtrip.c unity.c ../chirpy_tx.c -lm && ./test_roundtrip
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "../chirpy_tx.h"
+#include "unity.h"
+
+#define SAMPLE_RATE 32768
+#define TICK_SAMPLES (SAMPLE_RATE / 64)
+#define MAX_DATA 256
+#define MAX_TONES 2048
+#define TRIALS 8
+
+static const char *mode_names[] = {"classic", "dense", "dense+fec"};
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+// Deterministic noise, so a failure can be reproduced.
+static uint32_t rng_state;
+
+static uint32_t rng_next(void) {
+  rng_state ^= rng_state << 13;
+  rng_state ^= rng_state >> 17;
+  rng_state ^= rng_state << 5;
+  return rng_state;
+}
+
+static double rng_gaussian(void) {
+  double u1 = (rng_next() + 1.0) / 4294967297.0;
+  double u2 = (rng_next() + 1.0) / 4294967297.0;
+  return sqrt(-2 * log(u1)) * cos(2 * M_PI * u2);
+}
+
+static const uint8_t *curr_data;
+static uint16_t curr_data_len;
+static uint16_t curr_data_pos;
+
+static uint8_t get_next_byte(uint8_t *next_byte) {
+  if (curr_data_pos < curr_data_len) {
+    *next_byte = curr_data[curr_data_pos];
+    ++curr_data_pos;
+    return 1;
+  }
+  return 0;
+}
+
+static uint16_t encode(const uint8_t *data, uint16_t data_len, chirpy_mode_t mode, uint8_t *tones) {
+  curr_data = data;
+  curr_data_len = data_len;
+  curr_data_pos = 0;
+  chirpy_encoder_state_t ces;
+  chirpy_init_encoder_mode(&ces, get_next_byte, mode);
+  uint16_t count = 0;
+  while (count < MAX_TONES) {
+    uint8_t tone = chirpy_get_next_tone(&ces);
+    if (tone == 255) break;
+    tones[count++] = tone;
+  }
+  return count;
+}
+
+static uint8_t tone_ticks(chirpy_mode_t mode) {
+  chirpy_encoder_state_t ces;
+  chirpy_init_encoder_mode(&ces, get_next_byte, mode);
+  return chirpy_get_tone_ticks(&ces);
+}
+
+// Plays each tone for its ticks as a square wave, adds noise at snr_db (the square wave has a power of 1),
+// and returns the strongest of the mode's tones in each slot.
+static void transmit(const uint8_t *tones, uint16_t count, chirpy_mode_t mode, double snr_db, uint8_t *received) {
+  static float samples[TICK_SAMPLES * 3];
+  uint16_t slot = tone_ticks(mode) * TICK_SAMPLES;
+  uint8_t tone_count = mode == CHIRPY_MODE_CLASSIC ? 9 : 17;
+  double sigma = pow(10, -snr_db / 20);
+  double phase = 0;
+  for (uint16_t i = 0; i < count; ++i) {
+    double step = 1000000.0 / chirpy_get_tone_period(tones[i]) / SAMPLE_RATE;
+    for (uint16_t j = 0; j < slot; ++j) {
+      samples[j] = (phase < 0.5 ? 1 : -1) + (snr_db < 100 ? sigma * rng_gaussian() : 0);
+      phase += step;
+      if (phase >= 1) phase -= 1;
+    }
+    double best = -1;
+    for (uint8_t tone = 0; tone < tone_count; ++tone) {
+      // Listen for the frequency the buzzer actually plays, not the nominal one.
+      double coeff = 2 * cos(2 * M_PI * 1000000.0 / chirpy_get_tone_period(tone) / SAMPLE_RATE);
+      double s1 = 0, s2 = 0;
+      for (uint16_t j = 0; j < slot; ++j) {
+        double s0 = samples[j] + coeff * s1 - s2;
+        s2 = s1;
+        s1 = s0;
+      }
+      double power = s1 * s1 + s2 * s2 - coeff * s1 * s2;
+      if (power > best) {
+        best = power;
+        received[i] = tone;
+      }
+    }
+  }
+}
+
+// GF(16) arithmetic for the Reed-Solomon decoder, with the same field as the encoder.
+static uint8_t gf_exp[30];
+static uint8_t gf_log[16];
+
+static void gf_init(void) {
+  uint8_t x = 1;
+  for (uint8_t i = 0; i < 15; ++i) {
+    gf_exp[i] = gf_exp[i + 15] = x;
+    gf_log[x] = i;
+    x <<= 1;
+    if (x & 0x10) x ^= 0x13;
+  }
+}
+
+static uint8_t gf_mul(uint8_t a, uint8_t b) {
+  return (a == 0 || b == 0) ? 0 : gf_exp[gf_log[a] + gf_log[b]];
+}
+
+static uint8_t gf_div(uint8_t a, uint8_t b) {
+  return a == 0 ? 0 : gf_exp[gf_log[a] + 15 - gf_log[b]];
+}
+
+// The first symbol sent is the highest power of x.
+static void rs_syndromes(const uint8_t *codeword, uint8_t len, uint8_t *syndromes) {
+  for (uint8_t i = 0; i < 4; ++i) {
+    uint8_t s = 0;
+    for (uint8_t j = 0; j < len; ++j)
+      s = gf_mul(s, gf_exp[i]) ^ codeword[j];
+    syndromes[i] = s;
+  }
+}
+
+// Fixes up to 2 bad symbols; returns how many it fixed, or -1 if there are more than that.
+static int rs_correct(uint8_t *codeword, uint8_t len) {
+  uint8_t s[4];
+  rs_syndromes(codeword, len, s);
+  if (!(s[0] | s[1] | s[2] | s[3])) return 0;
+  // One error of size e at power a: S_i = e * a^i.
+  if (s[0] && s[1]) {
+    uint8_t a = gf_log[gf_div(s[1], s[0])];
+    if (a < len && gf_mul(s[1], gf_exp[a]) == s[2] && gf_mul(s[2], gf_exp[a]) == s[3]) {
+      codeword[len - 1 - a] ^= s[0];
+      return 1;
+    }
+  }
+  // Two errors: try every pair of positions, and check the sizes they'd need against S2 and S3.
+  for (uint8_t a = 0; a < len; ++a) {
+    for (uint8_t b = a + 1; b < len; ++b) {
+      uint8_t eb = gf_div(s[1] ^ gf_mul(s[0], gf_exp[a]), gf_exp[a] ^ gf_exp[b]);
+      uint8_t ea = s[0] ^ eb;
+      if (!ea || !eb) continue;
+      if ((gf_mul(ea, gf_exp[2 * a]) ^ gf_mul(eb, gf_exp[2 * b])) != s[2]) continue;
+      if ((gf_mul(ea, gf_exp[(3 * a) % 15]) ^ gf_mul(eb, gf_exp[(3 * b) % 15])) != s[3]) continue;
+      codeword[len - 1 - a] ^= ea;
+      codeword[len - 1 - b] ^= eb;
+      return 2;
+    }
+  }
+  return -1;
+}
+
+typedef struct {
+  uint16_t bytes;
+  uint16_t bad_bytes;
+  uint16_t blocks;
+  uint16_t bad_blocks;
+  uint16_t good_bytes;
+} roundtrip_result_t;
+
+// Decodes blocks by their length, since the receiver knows how many tones there were. Bytes in a block whose
+// CRC fails count as lost, even if they happen to be right.
+static void decode(const uint8_t *tones, uint16_t count, chirpy_mode_t mode, const uint8_t *data,
+                   roundtrip_result_t *result) {
+  uint8_t block_tones = mode == CHIRPY_MODE_CLASSIC ? 45 : mode == CHIRPY_MODE_DENSE ? 45 : 61;
+  uint16_t pos = 4;
+  uint16_t end = count - 2;
+  uint16_t offset = 0;
+  memset(result, 0, sizeof(*result));
+  while (pos < end) {
+    uint8_t block[64];
+    uint8_t len = end - pos < block_tones ? end - pos : block_tones;
+    memcpy(block, tones + pos, len);
+    pos += len;
+
+    uint8_t bytes[32];
+    uint8_t byte_count = 0;
+    uint8_t crc = 0;
+    if (mode == CHIRPY_MODE_CLASSIC) {
+      // data, control, 3 CRC tones, control
+      byte_count = 3 * (len - 5) / 8;
+      uint32_t bits = 0;
+      uint8_t bit_count = 0, j = 0;
+      for (uint8_t i = 0; i < byte_count; ++i) {
+        while (bit_count < 8) {
+          bits = (bits << 3) | (block[j++] & 7);
+          bit_count += 3;
+        }
+        bytes[i] = bits >> (bit_count - 8);
+        bit_count -= 8;
+      }
+      crc = (((block[len - 4] & 7) << 6) | ((block[len - 3] & 7) << 3) | (block[len - 2] & 7)) >> 1;
+    } else {
+      uint8_t nibbles[64];
+      uint8_t nibble_count = 0;
+      // A control tone heard in place of a data tone is just a wrong nibble.
+      for (uint8_t i = 0; i < len; ++i) block[i] &= 0x0F;
+      if (mode == CHIRPY_MODE_DENSE_FEC) {
+        for (uint8_t i = 0; i < len - 1; i += 15) {
+          uint8_t cw_len = len - 1 - i < 15 ? len - 1 - i : 15;
+          rs_correct(block + i, cw_len);
+          memcpy(nibbles + nibble_count, block + i, cw_len - 4);
+          nibble_count += cw_len - 4;
+        }
+      } else {
+        memcpy(nibbles, block, len - 1);
+        nibble_count = len - 1;
+      }
+      byte_count = (nibble_count - 2) / 2;
+      for (uint8_t i = 0; i <= byte_count; ++i) {
+        uint8_t byte = (nibbles[2 * i] << 4) | nibbles[2 * i + 1];
+        if (i < byte_count) bytes[i] = byte;
+        else crc = byte;
+      }
+    }
+
+    uint8_t crc_ok = chirpy_crc8(bytes, byte_count) == crc;
+    ++result->blocks;
+    if (!crc_ok) ++result->bad_blocks;
+    for (uint8_t i = 0; i < byte_count; ++i) {
+      uint8_t ok = bytes[i] == data[offset + i];
+      if (!ok) ++result->bad_bytes;
+      if (ok && crc_ok) ++result->good_bytes;
+    }
+    offset += byte_count;
+    result->bytes += byte_count;
+  }
+}
+
+static uint8_t test_data[MAX_DATA];
+static uint8_t sent[MAX_TONES];
+static uint8_t received[MAX_TONES];
+
+static double roundtrip(chirpy_mode_t mode, uint16_t data_len, double snr_db, roundtrip_result_t *result) {
+  for (uint16_t i = 0; i < data_len; ++i) test_data[i] = rng_next();
+  uint16_t count = encode(test_data, data_len, mode, sent);
+  transmit(sent, count, mode, snr_db, received);
+  decode(received, count, mode, test_data, result);
+  TEST_ASSERT_EQUAL(data_len, result->bytes);
+  // seconds on air
+  return count * tone_ticks(mode) / 64.0;
+}
+
+void test_dense_tones() {
+  const uint8_t data[] = {0x68};
+  const uint8_t expected[] = {16, 0, 16, 0, 6, 8, 10, 7, 16, 16, 16};
+  uint8_t tones[32];
+  uint16_t count = encode(data, 1, CHIRPY_MODE_DENSE, tones);
+  TEST_ASSERT_EQUAL(sizeof(expected), count);
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, tones, count);
+  TEST_ASSERT_EQUAL(2, tone_ticks(CHIRPY_MODE_DENSE));
+  TEST_ASSERT_EQUAL(3, tone_ticks(CHIRPY_MODE_CLASSIC));
+  TEST_ASSERT_EQUAL(153, chirpy_get_tone_period(16));
+  TEST_ASSERT_EQUAL(153, chirpy_get_tone_period(200));
+}
+
+void test_fec_codewords() {
+  // Every codeword, including the short last one of each block, has to come out a multiple of the generator.
+  for (uint16_t data_len = 1; data_len < 50; ++data_len) {
+    for (uint16_t i = 0; i < data_len; ++i) test_data[i] = rng_next();
+    uint16_t count = encode(test_data, data_len, CHIRPY_MODE_DENSE_FEC, sent);
+    TEST_ASSERT_EQUAL_UINT8(1, sent[3]);
+    for (uint16_t pos = 4; pos < count - 2; pos += 61) {
+      uint8_t len = count - 2 - pos < 61 ? count - 2 - pos : 61;
+      TEST_ASSERT_EQUAL_UINT8(16, sent[pos + len - 1]);
+      for (uint8_t i = 0; i < len - 1; i += 15) {
+        uint8_t s[4];
+        rs_syndromes(sent + pos + i, len - 1 - i < 15 ? len - 1 - i : 15, s);
+        TEST_ASSERT_EQUAL_UINT8(0, s[0] | s[1] | s[2] | s[3]);
+      }
+    }
+  }
+  // And two bad tones in a codeword get fixed.
+  uint8_t codeword[15];
+  memcpy(codeword, sent + 4, 15);
+  codeword[2] ^= 5;
+  codeword[13] ^= 11;
+  TEST_ASSERT_EQUAL(2, rs_correct(codeword, 15));
+  TEST_ASSERT_EQUAL_UINT8_ARRAY(sent + 4, codeword, 15);
+}
+
+void test_clean_roundtrip() {
+  roundtrip_result_t result;
+  for (chirpy_mode_t mode = CHIRPY_MODE_CLASSIC; mode <= CHIRPY_MODE_DENSE_FEC; ++mode) {
+    for (uint16_t data_len = 0; data_len < 70; ++data_len) {
+      roundtrip(mode, data_len, 1000, &result);
+      TEST_ASSERT_EQUAL(0, result.bad_bytes);
+      TEST_ASSERT_EQUAL(0, result.bad_blocks);
+    }
+  }
+}
+
+void test_noisy_roundtrip() {
+  static const double snrs[] = {0, -12, -15, -17, -19};
+  const uint8_t snr_count = sizeof(snrs) / sizeof(snrs[0]);
+  double rate[3][sizeof(snrs) / sizeof(snrs[0])];
+  double bad_blocks[3][sizeof(snrs) / sizeof(snrs[0])];
+  char buf[256];
+  TEST_MESSAGE("mode       SNR dB  raw B/s  effective B/s  byte errors  blocks lost");
+  for (chirpy_mode_t mode = CHIRPY_MODE_CLASSIC; mode <= CHIRPY_MODE_DENSE_FEC; ++mode) {
+    for (uint8_t k = 0; k < snr_count; ++k) {
+      uint32_t bytes = 0, bad_bytes = 0, good_bytes = 0, blocks = 0, lost = 0;
+      double seconds = 0;
+      // The same data and noise for each mode.
+      rng_state = 0x12345678 + k;
+      for (uint8_t trial = 0; trial < TRIALS; ++trial) {
+        roundtrip_result_t result;
+        seconds += roundtrip(mode, 210, snrs[k], &result);
+        bytes += result.bytes;
+        bad_bytes += result.bad_bytes;
+        good_bytes += result.good_bytes;
+        blocks += result.blocks;
+        lost += result.bad_blocks;
+      }
+      rate[mode][k] = good_bytes / seconds;
+      bad_blocks[mode][k] = (double)lost / blocks;
+      snprintf(buf, sizeof(buf), "%-9s  %6.0f  %7.1f  %13.1f  %10.2f%%  %10.1f%%", mode_names[mode], snrs[k],
+               bytes / seconds, rate[mode][k], 100.0 * bad_bytes / bytes, 100.0 * lost / blocks);
+      TEST_MESSAGE(buf);
+    }
+  }
+  // With a clear signal, every mode gets everything through, and the dense mode does it much faster.
+  for (chirpy_mode_t mode = CHIRPY_MODE_CLASSIC; mode <= CHIRPY_MODE_DENSE_FEC; ++mode)
+    TEST_ASSERT_EQUAL_FLOAT(0, bad_blocks[mode][0]);
+  TEST_ASSERT_TRUE(rate[CHIRPY_MODE_DENSE][0] > 1.8 * rate[CHIRPY_MODE_CLASSIC][0]);
+  // Error correction never loses more blocks than the same tones without it.
+  for (uint8_t k = 0; k < snr_count; ++k)
+    TEST_ASSERT_TRUE(bad_blocks[CHIRPY_MODE_DENSE_FEC][k] <= bad_blocks[CHIRPY_MODE_DENSE][k]);
+}
+
+int main(void) {
+  gf_init();
+  rng_state = 1;
+  UNITY_BEGIN();
+  RUN_TEST(test_dense_tones);
+  RUN_TEST(test_fec_codewords);
+  RUN_TEST(test_clean_roundtrip);
+  RUN_TEST(test_noisy_roundtrip);
+  return UNITY_END();
+}
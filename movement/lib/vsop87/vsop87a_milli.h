@@ -14,4 +14,33 @@
    void vsop87a_milli_getUranus(double t,double temp[]);
    void vsop87a_milli_getVenus(double t,double temp[]);
    void vsop87a_milli_getMoon(double earth[], double emb[],double temp[]);
+
+   // Individual series, one per axis. Useful for spreading a calculation out over several calls.
+   double vsop87a_milli_earth_x(double t);
+   double vsop87a_milli_earth_y(double t);
+   double vsop87a_milli_earth_z(double t);
+   double vsop87a_milli_emb_x(double t);
+   double vsop87a_milli_emb_y(double t);
+   double vsop87a_milli_emb_z(double t);
+   double vsop87a_milli_jupiter_x(double t);
+   double vsop87a_milli_jupiter_y(double t);
+   double vsop87a_milli_jupiter_z(double t);
+   double vsop87a_milli_mars_x(double t);
+   double vsop87a_milli_mars_y(double t);
+   double vsop87a_milli_mars_z(double t);
+   double vsop87a_milli_mercury_x(double t);
+   double vsop87a_milli_mercury_y(double t);
+   double vsop87a_milli_mercury_z(double t);
+   double vsop87a_milli_neptune_x(double t);
+   double vsop87a_milli_neptune_y(double t);
+   double vsop87a_milli_neptune_z(double t);
+   double vsop87a_milli_saturn_x(double t);
+   double vsop87a_milli_saturn_y(double t);
+   double vsop87a_milli_saturn_z(double t);
+   double vsop87a_milli_uranus_x(double t);
+   double vsop87a_milli_uranus_y(double t);
+   double vsop87a_milli_uranus_z(double t);
+   double vsop87a_milli_venus_x(double t);
+   double vsop87a_milli_venus_y(double t);
+   double vsop87a_milli_venus_z(double t);
 #endif
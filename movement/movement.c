@@ -110,6 +110,11 @@ of debounce time.
 #define MOVEMENT_DEFAULT_LED_DURATION 0
 #endif
 
+// Default to switching the led off at once, instead of fading it out over this many milliseconds
+#ifndef MOVEMENT_DEFAULT_LED_FADE_OUT_MS
+#define MOVEMENT_DEFAULT_LED_FADE_OUT_MS 0
+#endif
+
 // Default to no set location latitude
 #ifndef MOVEMENT_DEFAULT_LATITUDE
 #define MOVEMENT_DEFAULT_LATITUDE 0
@@ -145,6 +150,7 @@ watch_date_time scheduled_tasks[MOVEMENT_NUM_FACES];
 const int32_t movement_le_inactivity_deadlines[8] = {INT32_MAX, 10, 60, 600, 3600, 7200, 21600, 43200 };
 const int16_t movement_timeout_inactivity_deadlines[4] = { INT16_MAX, 60, 120, 300};
 movement_event_t event;
+static uint32_t face_setup_time;    // microseconds spent in the watch faces' setup functions at boot
 
 const int16_t movement_timezone_offsets[] = {
     0,      //  0 :   0:00:00 (UTC)
@@ -219,9 +225,7 @@ static inline void _movement_enable_fast_tick_if_needed(void) {
 }
 
 static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.debounce_ticks_light + movement_state.debounce_ticks_mode + movement_state.debounce_ticks_alarm) == 0) &&
+    if (((movement_state.debounce_ticks_light + movement_state.debounce_ticks_mode + movement_state.debounce_ticks_alarm) == 0) &&
         ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
         movement_state.fast_tick_enabled = false;
         movement_state.wake_light_state = 0;
@@ -235,7 +239,9 @@ static void _movement_handle_background_tasks(void) {
         if (watch_faces[i].wants_background_task != NULL && watch_faces[i].wants_background_task(&movement_state.settings, watch_face_contexts[i])) {
             // ...we give it one. pretty straightforward!
             movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+            uint8_t owner = filesystem_set_stats_owner(i);
             watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+            filesystem_set_stats_owner(owner);
         }
     }
     movement_state.needs_background_tasks_handled = false;
@@ -250,7 +256,9 @@ static void _movement_handle_scheduled_tasks(void) {
             if (scheduled_tasks[i].reg <= date_time.reg) {
                 scheduled_tasks[i].reg = 0;
                 movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+                uint8_t owner = filesystem_set_stats_owner(i);
                 watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+                filesystem_set_stats_owner(owner);
                 // check if loop scheduled a new task
                 if (scheduled_tasks[i].reg) {
                     num_active_tasks++;
@@ -284,11 +292,29 @@ void movement_request_tick_frequency(uint8_t freq) {
     watch_rtc_register_periodic_callback(cb_tick, freq);
 }
 
+static void _movement_led_off(void) {
+    watch_led_clear_timeout();
+    movement_state.light_waits_for_release = false;
+    movement_state.light_off_requested = false;
+    watch_led_fade_to_color(0, 0, MOVEMENT_DEFAULT_LED_FADE_OUT_MS, NULL);
+}
+
+static void _movement_led_timed_out(void) {
+    // this runs in the timer's interrupt, which wakes app_loop to do the actual turning off.
+    // unless the user is holding down the LIGHT button, in which case, give them more time.
+    if (watch_get_pin_level(BTN_LIGHT)) movement_state.light_waits_for_release = true;
+    else movement_state.light_off_requested = true;
+}
+
 void movement_illuminate_led(void) {
     watch_set_led_color(movement_state.settings.bit.led_red_color ? (0xF | movement_state.settings.bit.led_red_color << 4) : 0,
                         movement_state.settings.bit.led_green_color ? (0xF | movement_state.settings.bit.led_green_color << 4) : 0);
-    movement_state.light_ticks = MOVEMENT_DEFAULT_LED_DURATION == 0 ? 1 : (MOVEMENT_DEFAULT_LED_DURATION * 2 - 1) * 128;
-    _movement_enable_fast_tick_if_needed();
+    movement_state.light_waits_for_release = false;
+    movement_state.light_off_requested = false;
+    // the timeout runs while we sleep. An instant duration keeps the light on for as long as the button is down,
+    // so that one checks on the button right away.
+    watch_led_set_timeout(MOVEMENT_DEFAULT_LED_DURATION == 0 ? 8 : (MOVEMENT_DEFAULT_LED_DURATION * 2 - 1) * 1000,
+                          _movement_led_timed_out);
 }
 
 bool movement_default_loop_handler(movement_event_t event, movement_settings_t *settings) {
@@ -302,11 +328,7 @@ bool movement_default_loop_handler(movement_event_t event, movement_settings_t *
             movement_illuminate_led();
             break;
         case EVENT_LIGHT_BUTTON_UP:
-            if (MOVEMENT_DEFAULT_LED_DURATION == 0) {
-                watch_set_led_off();
-                movement_state.light_ticks = -1;
-                _movement_disable_fast_tick_if_possible();
-            }
+            if (MOVEMENT_DEFAULT_LED_DURATION == 0) _movement_led_off();
             break;
         case EVENT_MODE_LONG_PRESS:
             if (movement_state.current_face_idx == 0) {
@@ -383,6 +405,24 @@ void movement_request_wake() {
     _movement_reset_inactivity_countdown();
 }
 
+void movement_request_compute(void) {
+    movement_state.needs_compute = true;
+}
+
+void movement_request_performance_level(movement_performance_level_t level) {
+    switch (level) {
+        case MOVEMENT_PERFORMANCE_LEVEL_FASTEST:
+            watch_set_cpu_speed(WATCH_CPU_SPEED_16_MHZ);
+            break;
+        case MOVEMENT_PERFORMANCE_LEVEL_FAST:
+            watch_set_cpu_speed(WATCH_CPU_SPEED_8_MHZ);
+            break;
+        default:
+            watch_set_cpu_speed(WATCH_CPU_SPEED_4_MHZ);
+            break;
+    }
+}
+
 static void end_buzzing() {
     movement_state.is_buzzing = false;
 }
@@ -392,6 +432,17 @@ static void end_buzzing_and_disable_buzzer(void) {
     watch_disable_buzzer();
 }
 
+static void end_alarm(void) {
+    movement_state.is_alarming = false;
+    end_buzzing_and_disable_buzzer();
+}
+
+static void _movement_stop_alarm(void) {
+    if (!movement_state.is_alarming) return;
+    watch_buzzer_abort_sequence();
+    end_alarm();
+}
+
 void movement_play_signal(void) {
     void *maybe_disable_buzzer = end_buzzing_and_disable_buzzer;
     if (watch_is_buzzer_or_led_enabled()) {
@@ -399,7 +450,7 @@ void movement_play_signal(void) {
     }
     watch_enable_buzzer();
     movement_state.is_buzzing = true;
-    watch_buzzer_play_sequence(signal_tune_short, maybe_disable_buzzer);
+    watch_buzzer_play_tune(signal_tune_short, maybe_disable_buzzer);
     if (movement_state.le_mode_ticks == -1) {
         // the watch is asleep. wake it up for "1" round through the main loop.
         // the sleep_mode_app_loop will notice the is_buzzing and note that it
@@ -415,23 +466,45 @@ void movement_play_alarm(void) {
 }
 
 void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note) {
+    // a round is four beeps: 7 notes. the sequence is one round, then the silence and a round repeated as needed.
+    static int8_t alarm_sequence[(7 + 1 + 7 + 1) * 2 + 1];
+    int8_t *note = alarm_sequence;
+
     if (rounds == 0) rounds = 1;
     if (rounds > 20) rounds = 20;
     movement_request_wake();
-    movement_state.alarm_note = alarm_note;
-    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given.
-    movement_state.alarm_ticks = 128 * rounds - 75;
-    _movement_enable_fast_tick_if_needed();
+    end_buzzing();
+    watch_buzzer_abort_sequence();
+
+    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given; in 64ths of a second, less one.
+    for (uint8_t i = 0; i < 4; i++) {
+        *note++ = alarm_note;
+        *note++ = (i != 3) ? 2 : 4;
+        if (i == 3) break;
+        *note++ = BUZZER_NOTE_REST;
+        *note++ = 2;
+    }
+    if (rounds > 1) {
+        *note++ = BUZZER_NOTE_REST;
+        *note++ = 40;
+        memcpy(note, alarm_sequence, 7 * 2);
+        note += 7 * 2;
+        // a count of zero is the end of the sequence, which is just right for two rounds.
+        *note++ = -8;
+        *note++ = rounds - 2;
+    }
+    *note = 0;
+
+    movement_state.is_alarming = true;
+    watch_buzzer_play_sequence(alarm_sequence, end_alarm);
 }
 
-void movement_play_alarm_tune(int8_t alarm_tune[]) {
+void movement_play_alarm_tune(const uint8_t *alarm_tune) {
     movement_request_wake();
     end_buzzing();
     watch_buzzer_abort_sequence();
-    void *maybe_disable_buzzer = end_buzzing_and_disable_buzzer;
-    watch_buzzer_play_sequence(alarm_tune, maybe_disable_buzzer);
-    movement_state.alarm_ticks = 1;
-    _movement_enable_fast_tick_if_needed();
+    movement_state.is_alarming = true;
+    watch_buzzer_play_tune(alarm_tune, end_alarm);
 }
 
 uint8_t movement_claim_backup_register(void) {
@@ -439,6 +512,10 @@ uint8_t movement_claim_backup_register(void) {
     return movement_state.next_available_backup_register++;
 }
 
+uint32_t movement_get_face_setup_time(void) {
+    return face_setup_time;
+}
+
 void app_init(void) {
 #if defined(NO_FREQCORR)
     watch_rtc_freqcorr_write(0, 0);
@@ -568,12 +645,10 @@ void app_init(void) {
         0;
     #endif
 
-    movement_state.light_ticks = -1;
-    movement_state.alarm_ticks = -1;
     movement_state.next_available_backup_register = 4;
     _movement_reset_inactivity_countdown();
 
-    filesystem_init();
+    // the filesystem mounts itself the first time a watch face (or the shell) needs it.
 
 #if __EMSCRIPTEN__
     int32_t time_zone_offset = EM_ASM_INT({
@@ -633,9 +708,16 @@ void app_setup(void) {
 
         movement_request_tick_frequency(1);
 
+        uint32_t setup_start = watch_get_boot_timer_us();
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+            filesystem_set_stats_owner(i);
             watch_faces[i].setup(&movement_state.settings, i, &watch_face_contexts[i]);
         }
+        // from here on, filesystem I/O is charged to whichever face is on screen.
+        filesystem_set_stats_owner(movement_state.current_face_idx);
+        // the boot timer only runs while booting, not when we come back here from sleep mode.
+        uint32_t setup_end = watch_get_boot_timer_us();
+        if (setup_end > setup_start) face_setup_time = setup_end - setup_start;
 
         watch_faces[movement_state.current_face_idx].activate(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
         event.subsecond = 0;
@@ -656,9 +738,12 @@ static void _sleep_mode_app_loop(void) {
     while (movement_state.le_mode_ticks == -1) {
         // we also have to handle background tasks here in the mini-runloop
         if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
+        // background tasks can write files too; this runs once a minute, which is plenty.
+        filesystem_flush_if_stale();
 
         event.event_type = EVENT_LOW_ENERGY_UPDATE;
         watch_faces[movement_state.current_face_idx].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_DEFAULT);
 
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
@@ -672,11 +757,17 @@ bool app_loop(void) {
     bool woke_up_for_buzzer = false;
     if (movement_state.watch_face_changed) {
         if (!movement_state.watch_face_changed_silently && movement_state.settings.bit.button_should_sound) {
-            // low note for nonzero case, high note for return to watch_face 0
-            watch_buzzer_play_note(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50);
+            // low note for nonzero case, high note for return to watch_face 0. it plays while the next face sets up,
+            // but not over a signal or alarm tune, which would cut it off.
+            if (!movement_state.is_buzzing)
+                watch_buzzer_play_note_async(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50, NULL);
         }
         wf->resign(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        movement_state.needs_compute = false;
+        // whatever the face saved while it was on screen goes to flash now.
+        filesystem_flush();
         movement_state.current_face_idx = movement_state.next_face_idx;
+        filesystem_set_stats_owner(movement_state.current_face_idx);
         if (movement_state.current_face_idx == 0) {
             // if we are returning to the main watch face, reset the inactivity countdown
             _movement_reset_inactivity_countdown();
@@ -692,17 +783,8 @@ bool app_loop(void) {
         movement_state.watch_face_changed_silently = false;
     }
 
-    // if the LED should be off, turn it off
-    if (movement_state.light_ticks == 0) {
-        // unless the user is holding down the LIGHT button, in which case, give them more time.
-        if (watch_get_pin_level(BTN_LIGHT)) {
-            movement_state.light_ticks = 1;
-        } else {
-            watch_set_led_off();
-            movement_state.light_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
-        }
-    }
+    // turn off the LED, if its timeout or the LIGHT button's release told us to
+    if (movement_state.light_off_requested) _movement_led_off();
 
     // handle background tasks, if the alarm handler told us we need to
     if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
@@ -710,9 +792,13 @@ bool app_loop(void) {
     // if we have a scheduled background task, handle that here:
     if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
 
+    // don't let cached file writes sit in RAM for too long.
+    if (event.event_type == EVENT_TICK) filesystem_flush_if_stale();
+
     // if we have timed out of our low energy mode countdown, enter low energy mode.
     if (movement_state.current_face_idx == 0 && movement_state.le_mode_ticks == 0) {
         movement_state.le_mode_ticks = -1;
+        filesystem_flush();
         watch_register_extwake_callback(BTN_ALARM, cb_alarm_btn_extwake, true);
         watch_register_extwake_callback(A4, cb_a4_extwake, true);
         gpio_set_pin_pull_mode(A4, GPIO_PULL_DOWN);
@@ -744,6 +830,15 @@ bool app_loop(void) {
         event.event_type = EVENT_NONE;
     }
 
+    // if the face is partway through a long calculation, give it its next slice. Button and tick events set in
+    // the meantime are handled first on the next trip through the loop, which keeps the UI responsive.
+    if (movement_state.needs_compute && !movement_state.watch_face_changed) {
+        movement_state.needs_compute = false;
+        movement_event_t compute_event = { EVENT_COMPUTE, movement_state.subsecond };
+        bool can_sleep2 = wf->loop(compute_event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        can_sleep = can_sleep && can_sleep2;
+    }
+
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
     if (movement_state.settings.bit.to_interval && movement_state.current_face_idx != 0 && movement_state.timeout_ticks == 0) {
         movement_state.timeout_ticks = -1;
@@ -762,16 +857,15 @@ bool app_loop(void) {
     }
 
     // We gotta disable the buzzer check when playing the alarm
-    if (movement_state.alarm_ticks > 0) {
-        woke_up_for_buzzer = false;
-    } else if (movement_state.alarm_ticks == 0) {
-        movement_state.alarm_ticks = -1;
-        _movement_disable_fast_tick_if_possible();
-    }
+    if (movement_state.is_alarming) woke_up_for_buzzer = false;
+
+    // faces only get a faster clock for the event they asked for it in.
+    movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_DEFAULT);
 
     // if we are plugged into USB, handle the serial shell
     if (watch_is_usb_enabled()) {
-        shell_task();
+        // come straight back for any more commands, and for a button press a command may have injected.
+        if (shell_task() || event.event_type) can_sleep = false;
     }
 
     event.subsecond = 0;
@@ -779,8 +873,12 @@ bool app_loop(void) {
     // if the watch face changed, we can't sleep because we need to update the display.
     if (movement_state.watch_face_changed) can_sleep = false;
 
+    // if the face has more calculating to do, come right back around instead of sleeping.
+    if (movement_state.needs_compute) can_sleep = false;
+
     // if we woke up for the buzzer, stay awake until it's finished.
     if (woke_up_for_buzzer) {
+        watch_buzzer_wait_for_sequence();
         while(watch_is_buzzer_or_led_enabled());
     }
     // Woke up from the LIGHT button
@@ -788,15 +886,14 @@ bool app_loop(void) {
         movement_illuminate_led();
         movement_state.wake_light_state = 0;
     }
-    // if the LED is on, we need to stay awake to keep the TCC running.
-    if (movement_state.light_ticks != -1) can_sleep = false;
+    if (can_sleep) filesystem_sleep();
 
     return can_sleep;
 }
 
 static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, uint16_t *down_timestamp) {
     // force alarm off if the user pressed a button.
-    if (movement_state.alarm_ticks) movement_state.alarm_ticks = 0;
+    _movement_stop_alarm();
 
     if (pin_level) {
         // handle rising edge
@@ -804,10 +901,7 @@ static movement_event_type_t _figure_out_button_event(bool pin_level, movement_e
         *down_timestamp = movement_state.fast_ticks + 1;
         return button_down_event_type;
     } else {
-        // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
-        // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
-        if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
-        // now that that's out of the way, handle falling edge
+        // handle falling edge
         uint16_t diff = movement_state.fast_ticks - *down_timestamp;
         *down_timestamp = 0;
         // any press over a half second is considered a long press. Fire the long-up event
@@ -823,6 +917,8 @@ static movement_event_type_t btn_action(bool pin_level, int code, uint16_t *time
 
 static void light_btn_action(bool pin_level) {
     event.event_type = btn_action(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    // the LED's time ran out while the button was down.
+    if (!pin_level && movement_state.light_waits_for_release) movement_state.light_off_requested = true;
 }
 
 static void mode_btn_action(bool pin_level) {
@@ -838,9 +934,8 @@ static void alarm_btn_action(bool pin_level) {
     event.event_type = event_type;
 }
 
-static void debounce_btn_press(uint8_t pin, uint8_t *debounce_ticks, uint16_t *down_timestamp, void (*function)(bool)) {
+static void debounce_btn_press(bool pin_level, uint8_t *debounce_ticks, uint16_t *down_timestamp, void (*function)(bool)) {
     if (*debounce_ticks == 0) {
-        bool pin_level = watch_get_pin_level(pin);
         function(pin_level);
         *debounce_ticks = pin_level ? DEBOUNCE_TICKS_DOWN : DEBOUNCE_TICKS_UP;
         if (*debounce_ticks != 0) _movement_enable_fast_tick_if_needed();
@@ -861,15 +956,39 @@ static void movement_disable_if_debounce_complete(void) {
 }
 
 void cb_light_btn_interrupt(void) {
-    debounce_btn_press(BTN_LIGHT, &movement_state.debounce_ticks_light, &movement_state.light_down_timestamp, light_btn_action);
+    debounce_btn_press(watch_get_pin_level(BTN_LIGHT), &movement_state.debounce_ticks_light, &movement_state.light_down_timestamp, light_btn_action);
 }
 
 void cb_mode_btn_interrupt(void) {
-    debounce_btn_press(BTN_MODE, &movement_state.debounce_ticks_mode, &movement_state.mode_down_timestamp, mode_btn_action);
+    debounce_btn_press(watch_get_pin_level(BTN_MODE), &movement_state.debounce_ticks_mode, &movement_state.mode_down_timestamp, mode_btn_action);
 }
 
 void cb_alarm_btn_interrupt(void) {
-    debounce_btn_press(BTN_ALARM, &movement_state.debounce_ticks_alarm, &movement_state.alarm_down_timestamp, alarm_btn_action);
+    debounce_btn_press(watch_get_pin_level(BTN_ALARM), &movement_state.debounce_ticks_alarm, &movement_state.alarm_down_timestamp, alarm_btn_action);
+}
+
+void movement_inject_button(uint8_t pin, bool pressed) {
+    // the same path as the interrupts above, just with a level that didn't come from the pin.
+    if (pin == BTN_LIGHT) debounce_btn_press(pressed, &movement_state.debounce_ticks_light, &movement_state.light_down_timestamp, light_btn_action);
+    else if (pin == BTN_MODE) debounce_btn_press(pressed, &movement_state.debounce_ticks_mode, &movement_state.mode_down_timestamp, mode_btn_action);
+    else if (pin == BTN_ALARM) debounce_btn_press(pressed, &movement_state.debounce_ticks_alarm, &movement_state.alarm_down_timestamp, alarm_btn_action);
+}
+
+uint16_t movement_inject_ticks(uint16_t count, uint32_t *face_us) {
+    const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
+    uint16_t delivered = 0;
+    *face_us = 0;
+    // a face that asks to move on has to go through app_loop to do it, so stop there.
+    while (delivered < count && !movement_state.watch_face_changed) {
+        cb_tick();
+        event.subsecond = movement_state.subsecond;
+        watch_cycle_timer_start();
+        wf->loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        *face_us += watch_cycle_timer_get_us();
+        event.event_type = EVENT_NONE;
+        delivered++;
+    }
+    return delivered;
 }
 
 void cb_alarm_btn_extwake(void) {
@@ -891,8 +1010,6 @@ void cb_fast_tick(void) {
     movement_disable_if_debounce_complete();
     if (movement_state.debounce_ticks_light + movement_state.debounce_ticks_mode + movement_state.debounce_ticks_alarm  == 0)
         movement_state.fast_ticks++;
-    if (movement_state.light_ticks > 0) movement_state.light_ticks--;
-    if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
     // check timestamps and auto-fire the long-press events
     // Notice: is it possible that two or more buttons have an identical timestamp? In this case
     // only one of these buttons would receive the long press event. Don't bother for now...
@@ -905,7 +1022,7 @@ void cb_fast_tick(void) {
     if (movement_state.alarm_down_timestamp > 0)
         if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
             event.event_type = EVENT_ALARM_LONG_PRESS;
-    // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
+    // this is just a fail-safe; fast tick should be disabled as soon as the buttons are up and debounced.
     // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
     if (movement_state.fast_ticks >= 128 * 20) {
         watch_rtc_disable_periodic_callback(128);
@@ -94,6 +94,12 @@ typedef union {
     uint32_t reg;
 } movement_reserved_t;
 
+typedef enum {
+    MOVEMENT_PERFORMANCE_LEVEL_DEFAULT = 0, // 4 MHz, where the watch normally runs.
+    MOVEMENT_PERFORMANCE_LEVEL_FAST,        // 8 MHz
+    MOVEMENT_PERFORMANCE_LEVEL_FASTEST,     // 16 MHz
+} movement_performance_level_t;
+
 typedef enum {
     EVENT_NONE = 0,             // There is no event to report.
     EVENT_ACTIVATE,             // Your watch face is entering the foreground.
@@ -113,6 +119,7 @@ typedef enum {
     EVENT_ALARM_BUTTON_UP,      // The alarm button was pressed for less than half a second, and released.
     EVENT_ALARM_LONG_PRESS,     // The alarm button was held for over half a second, but not yet released.
     EVENT_ALARM_LONG_UP,        // The alarm button was held for over half a second, and released.
+    EVENT_COMPUTE,              // You asked for time to work on a long calculation with movement_request_compute. Do one short slice of it.
 } movement_event_type_t;
 
 typedef struct {
@@ -247,12 +254,12 @@ typedef struct {
     int16_t fast_ticks;
 
     // LED stuff
-    int16_t light_ticks;
+    bool light_waits_for_release;
+    bool light_off_requested;
 
     // alarm stuff
-    int16_t alarm_ticks;
+    bool is_alarming;
     bool is_buzzing;
-    BuzzerNote alarm_note;
 
     // button tracking for long press
     uint16_t light_down_timestamp;
@@ -284,6 +291,9 @@ typedef struct {
 
     // to track state of light after waking
     int16_t wake_light_state;
+
+    // set when the active face wants another EVENT_COMPUTE slice
+    bool needs_compute;
 } movement_state_t;
 
 void movement_move_to_face(uint8_t watch_face_index);
@@ -310,11 +320,37 @@ void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 
 void movement_request_wake(void);
 
+// Long calculations (astronomy, etc.) should not run to completion inside a single event, since that blocks buttons,
+// the LED timeout and alarms. Instead, do a bounded slice of work and call this function; Movement will call your
+// loop with EVENT_COMPUTE as soon as it has dealt with any pending events, and won't sleep in between. Call it again
+// from EVENT_COMPUTE until the calculation is done. The request is dropped when your face resigns.
+void movement_request_compute(void);
+
+// Runs the CPU faster until Movement has finished with the current event, then drops back to the default before
+// sleeping. Call it right before a burst of pure math, like an HMAC, a VSOP87 series or a sunrise calculation.
+// The trade-off: current draw goes up roughly in step with the clock, so the calculation itself costs about the same
+// energy at any speed, but the fixed cost of being awake (regulator, RAM, wakeup overhead) is paid for a shorter time.
+// That makes it a win for work that keeps the CPU busy, and a loss for anything that waits on something else, like a
+// sensor or the buzzer. Don't hold a boost across I2C, SPI, UART or ADC use, as those don't follow the clock change.
+// Does nothing while USB is connected, since USB already runs the watch at 8 MHz.
+void movement_request_performance_level(movement_performance_level_t level);
+
 void movement_play_signal(void);
 void movement_play_alarm(void);
 void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note);
-void movement_play_alarm_tune(int8_t alarm_tune[]);
+void movement_play_alarm_tune(const uint8_t *alarm_tune);
 
 uint8_t movement_claim_backup_register(void);
 
+// Returns how long, in microseconds, all the watch faces' setup functions took at boot. For the shell's boot command.
+uint32_t movement_get_face_setup_time(void);
+
+// For scripted UI tests and benchmarks, driven from the shell. movement_inject_button feeds a button edge through the
+// same debounce and event logic as the button interrupts; the current face gets the event on the next trip through
+// app_loop. movement_inject_ticks delivers up to count EVENT_TICKs to the current face right away, without waiting
+// for the RTC (which doesn't move, so faces still show the real time). It stops early if the face asks to move to
+// another one, and returns how many it delivered; face_us receives the time the face spent handling them.
+void movement_inject_button(uint8_t pin, bool pressed);
+uint16_t movement_inject_ticks(uint16_t count, uint32_t *face_us);
+
 #endif // MOVEMENT_H_
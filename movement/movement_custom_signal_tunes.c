@@ -1,2896 +0,0 @@
-/*
- * MIT License
- *
- * Copyright (c) 2023 Jeremy O'Brien
- *
- * Permission is hereby granted, free of charge, to any person obtaining a copy
- * of this software and associated documentation files (the "Software"), to deal
- * in the Software without restriction, including without limitation the rights
- * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
- * copies of the Software, and to permit persons to whom the Software is
- * furnished to do so, subject to the following conditions:
- *
- * The above copyright notice and this permission notice shall be included in all
- * copies or substantial portions of the Software.
- *
- * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
- * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
- * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
- * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
- * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
- * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
- * SOFTWARE.
- */
-
-#include "watch_buzzer.h"
-
-int8_t signal_tune_short[] = {
-    BUZZER_NOTE_C8, 5,
-    BUZZER_NOTE_REST, 6,
-    BUZZER_NOTE_C8, 5,
-    0
-};
-
-int8_t *signal_tunes[] = {
-    // never_gonna_give_you_up
-    (int8_t[]) {
-        BUZZER_NOTE_G5SHARP_A5FLAT, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F6, 18,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F6, 23,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 35,
-        BUZZER_NOTE_REST, 16,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 22,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 23,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 20,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 18,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 9,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 30,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 18,
-        BUZZER_NOTE_C6, 16,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 16,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 19,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 26,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 34,
-        BUZZER_NOTE_REST, 35,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_F6, 20,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_F6, 23,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 36,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 9,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 30,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_C6, 18,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 16,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 17,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 9,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 33,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 15,
-        BUZZER_NOTE_C6, 28,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 9,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 15,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 17,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 15,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 39,
-        0, // End of the song
-    },
-    // imperial_march
-    (int8_t[]) {
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 20,
-        BUZZER_NOTE_REST, 15,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 22,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 22,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_B4, 17,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 5,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 25,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 17,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 5,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 45,
-        BUZZER_NOTE_REST, 26,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 23,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 22,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 23,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_B5, 16,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D5, 25,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 15,
-        BUZZER_NOTE_REST, 11,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 31,
-        BUZZER_NOTE_REST, 40,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 28,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 18,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 7,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 22,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D6, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 6,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_B5, 6,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_REST, 28,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_REST, 11,
-        BUZZER_NOTE_A5, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F5, 5,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_REST, 28,
-        BUZZER_NOTE_B4, 6,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_D5, 22,
-        BUZZER_NOTE_REST, 15,
-        BUZZER_NOTE_B4, 20,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D5, 4,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 24,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 45,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 28,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 18,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 7,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 22,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D6, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 6,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_B5, 6,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_REST, 28,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_REST, 11,
-        BUZZER_NOTE_A5, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 5,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_F5, 5,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_REST, 29,
-        BUZZER_NOTE_B4, 6,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_D5, 22,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_B4, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 24,
-        BUZZER_NOTE_REST, 11,
-        BUZZER_NOTE_B4, 20,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 5,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 45,
-        0, // End of the song
-    },
-    // fur_elise
-    (int8_t[]) {
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 14,
-        BUZZER_NOTE_C6, 14,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_C5, 14,
-        BUZZER_NOTE_E5, 14,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 14,
-        BUZZER_NOTE_C6, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 14,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_D5, 14,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 28,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 14,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_C5, 14,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_E5, 14,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 14,
-        BUZZER_NOTE_B5, 14,
-        BUZZER_NOTE_C6, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_E5, 14,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E6, 14,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 14,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 14,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 14,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 27,
-        BUZZER_NOTE_REST, 14,
-        BUZZER_NOTE_D5, 14,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 27,
-        0, // End of the song
-    },
-    // mortal_kombat
-    (int8_t[]) {
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 18,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 18,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_D6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F5, 18,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F5, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_F5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_C6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_B5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_E5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 19,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 16,
-        BUZZER_NOTE_REST, 19,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E6, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_A5, 16,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_A5, 17,
-        0, // End of the song
-    },
-    // ussr
-    (int8_t[]) {
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A4, 18,
-        BUZZER_NOTE_REST, 18,
-        BUZZER_NOTE_A4, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B4, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B4, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 65,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A4, 18,
-        BUZZER_NOTE_REST, 18,
-        BUZZER_NOTE_A4, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 65,
-        BUZZER_NOTE_REST, 30,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 89,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 65,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 65,
-        BUZZER_NOTE_REST, 30,
-        BUZZER_NOTE_A5, 89,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 65,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 42,
-        BUZZER_NOTE_REST, 54,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 18,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D6, 65,
-        BUZZER_NOTE_REST, 30,
-        BUZZER_NOTE_D6, 89,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_B5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 65,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 65,
-        BUZZER_NOTE_REST, 30,
-        BUZZER_NOTE_B5, 89,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 65,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 65,
-        BUZZER_NOTE_REST, 30,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 18,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A4, 18,
-        BUZZER_NOTE_REST, 18,
-        BUZZER_NOTE_A4, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 42,
-        0, // End of the song
-    },
-    // birthday
-    (int8_t[]) {
-        BUZZER_NOTE_D5SHARP_E5FLAT, 15,
-        BUZZER_NOTE_REST, 9,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 7,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_F5, 32,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 32,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 35,
-        BUZZER_NOTE_REST, 1,
-        BUZZER_NOTE_G5, 42,
-        BUZZER_NOTE_REST, 29,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 15,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 7,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_F5, 31,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 29,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 53,
-        BUZZER_NOTE_REST, 18,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 16,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 29,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6, 33,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 19,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_G5, 37,
-        BUZZER_NOTE_F5, 28,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 20,
-        BUZZER_NOTE_REST, 3,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 8,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_C6, 36,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 30,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 32,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 42,
-        0, // End of the song
-    },
-    // mariobros2
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5, 20,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5, 20,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_A5, 20,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_E5, 20,
-        BUZZER_NOTE_C5, 7,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_B4, 20,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D5, 20,
-        BUZZER_NOTE_C5, 27,
-        0, // End of the song
-    },
-    // wake_me_up_before_you_go
-    (int8_t[]) {
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_G6, 21,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_G6, 21,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C5, 10,
-        0, // End of the song
-    },
-    // rudolf
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_G5, 62,
-        BUZZER_NOTE_G5, 16,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_G5, 16,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_B5, 83,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_D5, 21,
-        BUZZER_NOTE_B5, 21,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_G5, 62,
-        BUZZER_NOTE_G5, 16,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_G5, 16,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_C6, 62,
-        0, // End of the song
-    },
-    // rich
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 21,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 21,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_REST, 21,
-        0, // End of the song
-    },
-    // blue
-    (int8_t[]) {
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 27,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 27,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 40,
-        0, // End of the song
-    },
-    // rapture
-    (int8_t[]) {
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_REST, 107,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 27,
-        BUZZER_NOTE_F6, 53,
-        BUZZER_NOTE_REST, 107,
-        0, // End of the song
-    },
-    // vannessamae
-    (int8_t[]) {
-        BUZZER_NOTE_G6, 6,
-        BUZZER_NOTE_F6, 6,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_D6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G6, 6,
-        BUZZER_NOTE_F6, 6,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G6, 6,
-        BUZZER_NOTE_F6, 6,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_D6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_D6, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_D5, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_G5, 6,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 6,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_D6, 24,
-        BUZZER_NOTE_REST, 12,
-        0, // End of the song
-    },
-    // strangers_in_the_night
-    (int8_t[]) {
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D5, 27,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 27,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 27,
-        0, // End of the song
-    },
-    // birdy
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_E5, 8,
-        BUZZER_NOTE_E5, 8,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_E5, 8,
-        BUZZER_NOTE_E5, 8,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_B5, 17,
-        BUZZER_NOTE_B5, 17,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_F5, 17,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_D5, 8,
-        BUZZER_NOTE_D5, 8,
-        BUZZER_NOTE_F5, 17,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_D5, 8,
-        BUZZER_NOTE_D5, 8,
-        BUZZER_NOTE_F5, 17,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_G5, 8,
-        BUZZER_NOTE_A5, 8,
-        BUZZER_NOTE_B5, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_E5, 17,
-        BUZZER_NOTE_C5, 33,
-        0, // End of the song
-    },
-    // popcorn
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_C6, 5,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_C6, 5,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 5,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 5,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_C6, 21,
-        0, // End of the song
-    },
-    // fiddler
-    (int8_t[]) {
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 42,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 42,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 21,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_E5, 42,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 21,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 21,
-        0, // End of the song
-    },
-    // looney_tunes
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 24,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_A5, 36,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 36,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_F5, 12,
-        0, // End of the song
-    },
-    // spiderman
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_G6, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_C6, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 8,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_C6, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_F6, 17,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 8,
-        BUZZER_NOTE_C7, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 17,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 8,
-        BUZZER_NOTE_F6, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_G6, 25,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 8,
-        BUZZER_NOTE_G6, 33,
-        BUZZER_NOTE_REST, 17,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 8,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_F6, 17,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 8,
-        BUZZER_NOTE_C6, 33,
-        0, // End of the song
-    },
-    // barbie_girl
-    (int8_t[]) {
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 27,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 27,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 27,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 27,
-        0, // End of the song
-    },
-    // animaniacs
-    (int8_t[]) {
-        BUZZER_NOTE_D6SHARP_E6FLAT, 21,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 21,
-        BUZZER_NOTE_F6, 31,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_D6, 31,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 42,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_F6, 31,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_D6, 31,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 21,
-        BUZZER_NOTE_REST, 42,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 10,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 10,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 16,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 5,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 10,
-        BUZZER_NOTE_F6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 21,
-        BUZZER_NOTE_C7, 21,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 31,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 10,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 21,
-        0, // End of the song
-    },
-    // tubullar_bells
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G6, 12,
-        0, // End of the song
-    },
-    // island_swing
-    (int8_t[]) {
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 6,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 12,
-        BUZZER_NOTE_REST, 48,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 6,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_C6, 6,
-        BUZZER_NOTE_D6, 18,
-        BUZZER_NOTE_REST, 48,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 12,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_B5, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_REST, 6,
-        BUZZER_NOTE_E5, 6,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 12,
-        BUZZER_NOTE_A5, 6,
-        BUZZER_NOTE_B5, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_E6, 6,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_D6, 6,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_B5, 6,
-        BUZZER_NOTE_C6, 18,
-        0, // End of the song
-    },
-    // aha
-    (int8_t[]) {
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 10,
-        0, // End of the song
-    },
-    // funky
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 53,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_C6, 13,
-        0, // End of the song
-    },
-    // tetris
-    (int8_t[]) {
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_E6, 5,
-        BUZZER_NOTE_D6, 5,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 31,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_A5, 42,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_A6, 21,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_E6, 31,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 21,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_A5, 42,
-        0, // End of the song
-    },
-    // flute
-    (int8_t[]) {
-        BUZZER_NOTE_A5, 4,
-        BUZZER_NOTE_G5, 5,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 5,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_F5, 31,
-        BUZZER_NOTE_REST, 31,
-        BUZZER_NOTE_F5, 4,
-        BUZZER_NOTE_E5, 5,
-        BUZZER_NOTE_F5, 5,
-        BUZZER_NOTE_G5, 5,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_D5, 31,
-        BUZZER_NOTE_REST, 31,
-        BUZZER_NOTE_D5, 4,
-        BUZZER_NOTE_C5, 5,
-        BUZZER_NOTE_D5, 5,
-        BUZZER_NOTE_E5, 5,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_F5, 31,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_A4, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_A4, 10,
-        BUZZER_NOTE_B4, 10,
-        BUZZER_NOTE_A4, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        0, // End of the song
-    },
-    // pink_panther
-    (int8_t[]) {
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 42,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_REST, 42,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 5,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 42,
-        BUZZER_NOTE_REST, 42,
-        BUZZER_NOTE_A5, 5,
-        BUZZER_NOTE_G5, 5,
-        BUZZER_NOTE_E5, 5,
-        BUZZER_NOTE_D5, 5,
-        BUZZER_NOTE_E5, 42,
-        0, // End of the song
-    },
-    // girl_of_ipanema
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 31,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5, 21,
-        BUZZER_NOTE_G5, 31,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_G5, 31,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_D5, 21,
-        BUZZER_NOTE_D5, 21,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_C5, 21,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_A4SHARP_B4FLAT, 21,
-        BUZZER_NOTE_C5, 42,
-        0, // End of the song
-    },
-    // simpsons
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 31,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 21,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_G6, 31,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 42,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 31,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_C6, 21,
-        0, // End of the song
-    },
-    // colinelb
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E6, 24,
-        BUZZER_NOTE_E6, 24,
-        BUZZER_NOTE_C6, 48,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_G5, 24,
-        BUZZER_NOTE_G5, 24,
-        BUZZER_NOTE_F5, 48,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_G5, 18,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 6,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E6, 24,
-        BUZZER_NOTE_E6, 24,
-        BUZZER_NOTE_C6, 48,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_G5, 24,
-        BUZZER_NOTE_G5, 24,
-        BUZZER_NOTE_F5, 48,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_B5, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_E5, 12,
-        BUZZER_NOTE_D5, 12,
-        BUZZER_NOTE_A5, 12,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_C5, 12,
-        BUZZER_NOTE_B4, 12,
-        BUZZER_NOTE_G5, 12,
-        BUZZER_NOTE_REST, 12,
-        BUZZER_NOTE_B4, 12,
-        BUZZER_NOTE_C5, 71,
-        BUZZER_NOTE_REST, 24,
-        0, // End of the song
-    },
-    // knight_rider
-    (int8_t[]) {
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_B5, 26,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_F6, 7,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_B5, 26,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_D6, 53,
-        BUZZER_NOTE_REST, 26,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_B5, 26,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_F6, 7,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_B5, 26,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_F6, 53,
-        0, // End of the song
-    },
-    // ride_of_the_valkyries
-    (int8_t[]) {
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_E5, 3,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_A5, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_A5, 3,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_C6, 3,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_G6, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_G5, 3,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_E6, 42,
-        BUZZER_NOTE_REST, 21,
-        0, // End of the song
-    },
-    // ateam
-    (int8_t[]) {
-        BUZZER_NOTE_D6SHARP_E6FLAT, 27,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 53,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 27,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 40,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_F6, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 53,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 20,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 20,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 53,
-        0, // End of the song
-    },
-    // pacman
-    (int8_t[]) {
-        BUZZER_NOTE_B5, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_B6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_B6, 4,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 4,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_C6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_C7, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_E6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_C7, 4,
-        BUZZER_NOTE_G6, 4,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_B5, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_B6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_B6, 4,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 4,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 4,
-        BUZZER_NOTE_E6, 4,
-        BUZZER_NOTE_F6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_F6, 4,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 4,
-        BUZZER_NOTE_G6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_G6, 4,
-        BUZZER_NOTE_G6SHARP_A6FLAT, 4,
-        BUZZER_NOTE_A6, 4,
-        BUZZER_NOTE_REST, 4,
-        BUZZER_NOTE_B6, 6,
-        0, // End of the song
-    },
-    // adams_family
-    (int8_t[]) {
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_B4, 21,
-        BUZZER_NOTE_G5, 42,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_E4, 10,
-        BUZZER_NOTE_A4, 21,
-        BUZZER_NOTE_F5, 42,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_F5, 21,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_B4, 21,
-        BUZZER_NOTE_G5, 42,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_E5, 21,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_D5, 21,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 83,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        BUZZER_NOTE_REST, 83,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_REST, 83,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_C5, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5, 10,
-        0, // End of the song
-    },
-    // the_riddle
-    (int8_t[]) {
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 27,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_C5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 27,
-        BUZZER_NOTE_G5, 27,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_D5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_C5, 27,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 27,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_C5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_F5, 27,
-        BUZZER_NOTE_G5, 27,
-        BUZZER_NOTE_F5, 13,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_D5, 27,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_C5, 13,
-        BUZZER_NOTE_C5, 27,
-        0, // End of the song
-    },
-    // bach
-    (int8_t[]) {
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 13,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 7,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 13,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_D6, 27,
-        0, // End of the song
-    },
-    // minuet
-    (int8_t[]) {
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_E6, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 10,
-        BUZZER_NOTE_G6, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_G5, 21,
-        BUZZER_NOTE_C6, 21,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 21,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_G5, 10,
-        BUZZER_NOTE_B5, 3,
-        BUZZER_NOTE_C5, 3,
-        BUZZER_NOTE_B5, 5,
-        BUZZER_NOTE_C6, 5,
-        BUZZER_NOTE_B5, 5,
-        BUZZER_NOTE_A5, 62,
-        0, // End of the song
-    },
-    // indiana
-    (int8_t[]) {
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_C6, 53,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5, 53,
-        BUZZER_NOTE_REST, 20,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_F6, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 27,
-        BUZZER_NOTE_D6, 27,
-        BUZZER_NOTE_E6, 27,
-        BUZZER_NOTE_E5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_F5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_C6, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_E6, 7,
-        BUZZER_NOTE_F6, 80,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_E6, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_E6, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_F6, 20,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_E6, 13,
-        BUZZER_NOTE_REST, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_C6, 27,
-        0, // End of the song
-    },
-    // 90210
-    (int8_t[]) {
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6, 36,
-        BUZZER_NOTE_D6, 48,
-        BUZZER_NOTE_REST, 24,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 24,
-        BUZZER_NOTE_F6, 36,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 71,
-        BUZZER_NOTE_F5, 12,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_C6, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_G6, 12,
-        BUZZER_NOTE_F6, 24,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 24,
-        BUZZER_NOTE_D6, 24,
-        BUZZER_NOTE_C6, 71,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_A5, 24,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 36,
-        BUZZER_NOTE_G6, 24,
-        BUZZER_NOTE_F6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 12,
-        BUZZER_NOTE_D6, 12,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 12,
-        BUZZER_NOTE_F5, 24,
-        0, // End of the song
-    },
-    // figaro
-    (int8_t[]) {
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_REST, 2,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_E5, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_A4, 7,
-        BUZZER_NOTE_B4, 7,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_REST, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_REST, 53,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D5, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_REST, 53,
-        0, // End of the song
-    },
-    // doraemon
-    (int8_t[]) {
-        BUZZER_NOTE_G5, 17,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_C6, 17,
-        BUZZER_NOTE_E6, 8,
-        BUZZER_NOTE_A6, 17,
-        BUZZER_NOTE_E6, 8,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_A6, 8,
-        BUZZER_NOTE_G6, 17,
-        BUZZER_NOTE_E6, 8,
-        BUZZER_NOTE_F6, 17,
-        BUZZER_NOTE_E6, 8,
-        BUZZER_NOTE_D6, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_D6, 8,
-        BUZZER_NOTE_D6, 17,
-        BUZZER_NOTE_F6, 8,
-        BUZZER_NOTE_B6, 17,
-        BUZZER_NOTE_B6, 8,
-        BUZZER_NOTE_A6, 17,
-        BUZZER_NOTE_G6, 8,
-        BUZZER_NOTE_F6, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_F6, 17,
-        BUZZER_NOTE_E6, 8,
-        BUZZER_NOTE_A5, 17,
-        BUZZER_NOTE_B5, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_C6, 8,
-        BUZZER_NOTE_D6, 17,
-        0, // End of the song
-    },
-    // flintstones
-    (int8_t[]) {
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 17,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 8,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 17,
-        BUZZER_NOTE_F5, 33,
-        BUZZER_NOTE_REST, 33,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 17,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_REST, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 17,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5, 8,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 8,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 8,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 17,
-        BUZZER_NOTE_D5SHARP_E5FLAT, 17,
-        BUZZER_NOTE_C5SHARP_D5FLAT, 33,
-        0, // End of the song
-    },
-    // final_countdown
-    (int8_t[]) {
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_B5, 27,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 27,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_REST, 13,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_G5, 40,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 7,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_A5, 40,
-        BUZZER_NOTE_G5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5, 13,
-        BUZZER_NOTE_G5, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_E5, 27,
-        BUZZER_NOTE_C6, 27,
-        BUZZER_NOTE_B5, 80,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_C6, 7,
-        BUZZER_NOTE_B5, 7,
-        BUZZER_NOTE_A5, 7,
-        BUZZER_NOTE_B5, 107,
-        0, // End of the song
-    },
-    // frogger
-    (int8_t[]) {
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 27,
-        BUZZER_NOTE_REST, 27,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_D6SHARP_E6FLAT, 13,
-        BUZZER_NOTE_C6SHARP_D6FLAT, 13,
-        BUZZER_NOTE_B5, 13,
-        BUZZER_NOTE_A5SHARP_B5FLAT, 13,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 13,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 27,
-        0, // End of the song
-    },
-    // sabrewulf
-    (int8_t[]) {
-        BUZZER_NOTE_D7, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_C7, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_D7, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_C7, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_F6SHARP_G6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 7,
-        BUZZER_NOTE_D6, 7,
-        BUZZER_NOTE_G6, 7,
-        BUZZER_NOTE_D6, 7,
-        0, // End of the song
-    },
-    // take_on_me
-    (int8_t[]) {
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_B4, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_G5SHARP_A5FLAT, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_B5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_D5, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_F5SHARP_G5FLAT, 10,
-        BUZZER_NOTE_E5, 10,
-        BUZZER_NOTE_E5, 10,
-        0, // End of the song
-    },
-    // itchy_and_scratchy
-    (int8_t[]) {
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A5, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_A6, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_REST, 10,
-        BUZZER_NOTE_E6, 10,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_G6, 10,
-        BUZZER_NOTE_REST, 21,
-        BUZZER_NOTE_D6, 10,
-        BUZZER_NOTE_C6, 10,
-        BUZZER_NOTE_D6, 21,
-        BUZZER_NOTE_F6, 10,
-        BUZZER_NOTE_A6SHARP_B6FLAT, 21,
-        BUZZER_NOTE_A6, 21,
-        BUZZER_NOTE_C7, 42,
-        0, // End of the song
-    }
-};
-
-const size_t NUM_TUNES = sizeof(signal_tunes) / sizeof(signal_tunes[0]);
\ No newline at end of file
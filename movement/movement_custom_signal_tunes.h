@@ -25,8 +25,15 @@
 #ifndef MOVEMENT_CUSTOM_SIGNAL_TUNES_H
 #define MOVEMENT_CUSTOM_SIGNAL_TUNES_H
 
-extern size_t NUM_TUNES;
-extern int8_t signal_tune_short[];
-extern int8_t *signal_tunes[];
+#include <stddef.h>
+#include <stdint.h>
+
+// The tunes are written in movement_custom_signal_tunes.txt, and the build compresses them into C with
+// utils/tune_converter.py. Play them with watch_buzzer_play_tune. signal_tunes only has the tunes named in
+// SIGNAL_TUNES in the Makefile, or all of them if it's empty.
+
+extern const size_t NUM_TUNES;
+extern const uint8_t signal_tune_short[];
+extern const uint8_t *const signal_tunes[];
 
 #endif // MOVEMENT_CUSTOM_SIGNAL_TUNES_H
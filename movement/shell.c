@@ -21,7 +21,6 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-
 #include "shell.h"
 
 #include <ctype.h>
@@ -37,6 +36,7 @@
 #endif
 
 #include "watch.h"
+#include "filesystem.h"
 #include "shell_cmd_list.h"
 
 extern shell_command_t g_shell_commands[];
@@ -47,175 +47,288 @@ extern const size_t g_num_shell_commands;
 #define SHELL_BUF_SZ  (256)
 #define SHELL_MAX_ARGS  (16)
 #define SHELL_PROMPT  "swsh> "
+// How much input we take from the USB read buffer at once.
+#define SHELL_INPUT_SZ  (64)
+// Room for the last few commands, for the up and down arrows.
+#define SHELL_HISTORY_SZ  (256)
+// Echo goes out in one write per batch of input, not one per character.
+#define SHELL_ECHO_SZ  (64)
 
 static char s_buf[SHELL_BUF_SZ] = {0};
 static size_t s_buf_len = 0;
-// Pointer to the first invalid byte after the end of input.
-static char *const s_buf_end = s_buf + SHELL_BUF_SZ;
 
-static char *prv_skip_whitespace(char *c) {
-    while (c >= s_buf && c < s_buf_end) {
-        if (*c == 0) {
-            return NULL;
+#if !__EMSCRIPTEN__
+
+// Input we've read but not handled yet. We stop after each command, so that
+// anything it set in motion (like a button press) happens before the next one.
+static char s_input[SHELL_INPUT_SZ];
+static uint8_t s_input_pos = 0;
+static uint8_t s_input_len = 0;
+
+static char s_echo[SHELL_ECHO_SZ];
+static size_t s_echo_len = 0;
+
+// Previous commands, newest first, each with a null after it. An empty
+// string (two nulls in a row) marks the end.
+static char s_history[SHELL_HISTORY_SZ] = {0};
+// How far back the up arrow has gone; 0 is the line being typed.
+static uint8_t s_history_pos = 0;
+
+// Where we are in an escape sequence: 1 after ESC, 2 after ESC [.
+static uint8_t s_escape = 0;
+// Terminals send \r\n or just \r; either ends one command, not two.
+static bool s_last_was_cr = false;
+
+#endif
+
+// Splits s_buf into arguments in place, with basic handling of quoted
+// arguments (which can't nest :( ). Quotes stay part of the argument.
+static int prv_tokenize(char *argv[]) {
+    int argc = 0;
+    char *c = s_buf;
+
+    while (argc < SHELL_MAX_ARGS) {
+        while (*c != '\0' && isspace((int) *c)) {
+            c++;
+        }
+        if (*c == '\0') {
+            break;
+        }
+        argv[argc++] = c;
+
+        char quote_char = 0;
+        while (*c != '\0' && (quote_char != 0 || !isspace((int) *c))) {
+            if (*c == quote_char) {
+                quote_char = 0;
+            } else if (quote_char == 0 && (*c == '"' || *c == '\'')) {
+                quote_char = *c;
+            }
+            c++;
         }
-        if ((!isspace((int) *c)) != 0) {
-            return c;
+        if (*c == '\0') {
+            break;
         }
-        c++;
+        *(c++) = '\0';
     }
-    return NULL;
+
+    return argc;
 }
 
-static char *prv_skip_non_whitespace(char *c) {
-    bool in_quote = false;
-    char quote_char;
-    while (c >= s_buf && c < s_buf_end) {
-        if (*c == 0) {
-            return NULL;
+static shell_command_t *prv_find_command(const char *name) {
+    // g_shell_commands is sorted by name.
+    size_t lo = 0;
+    size_t hi = g_num_shell_commands;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        int cmp = strcasecmp(name, g_shell_commands[mid].name);
+        if (cmp == 0) {
+            return &g_shell_commands[mid];
         }
-        // Basic handling of quoted arguments.
-        // Can't handle recursive quotes. :(
-        if (in_quote || *c == '"' || *c == '\'') {
-            if (!in_quote) {
-                quote_char = *c;
-                in_quote = true;
-            } else if (*c == quote_char) {
-                in_quote = false;
-            }
+        if (cmp < 0) {
+            hi = mid;
         } else {
-            if (isspace((int) *c) != 0) {
-                return c;
-            }
+            lo = mid + 1;
         }
-        c++;
     }
     return NULL;
 }
 
-static int prv_handle_command() {
+static int prv_handle_command(void) {
     char *argv[SHELL_MAX_ARGS] = {0};
-    int argc = 0;
 
-    char *c = &s_buf[0];
-    s_buf[SHELL_BUF_SZ - 1] = '\0';
+    s_buf[min(s_buf_len, SHELL_BUF_SZ - 1)] = '\0';
+    int argc = prv_tokenize(argv);
+    if (argc == 0) {
+        return -1;
+    }
 
-    while (argc < SHELL_MAX_ARGS) {
-        // Skip contiguous whitespace
-        c = prv_skip_whitespace(c);
-        if (c == NULL) {
-            // Reached end of buffer
-            break;
+    shell_command_t *command = prv_find_command(argv[0]);
+    if (command == NULL || command->cb == NULL) {
+        return -1;
+    }
+
+    // If argc isn't valid for this command, display its help instead.
+    if (((argc - 1) < command->min_args) || ((argc - 1) > command->max_args)) {
+        if (command->help != NULL) {
+            printf(NEWLINE "%s" NEWLINE, command->help);
         }
+        return -2;
+    }
 
-        // We hit non-whitespace, set argv and argc for this upcoming argument
-        argv[argc++] = c;
+    // Call the command's callback
+    printf(NEWLINE);
+    uint8_t owner = filesystem_set_stats_owner(FILESYSTEM_STATS_OWNER_SHELL);
+    int ret = command->cb(argc, argv);
+    filesystem_set_stats_owner(owner);
+    if (ret == -2) {
+        printf(NEWLINE "%s" NEWLINE, command->help);
+    }
+    return ret;
+}
 
-        // Skip contiguous non-whitespace
-        c = prv_skip_non_whitespace(c);
-        if (c == NULL) {
-            // Reached end of buffer
-            break;
-        }
+#if !__EMSCRIPTEN__
 
-        // NULL-terminate this arg string and then increment.
-        *(c++) = '\0';
+static void prv_flush_echo(void) {
+    if (s_echo_len > 0) {
+        fwrite(s_echo, 1, s_echo_len, stdout);
+        fflush(stdout);
+        s_echo_len = 0;
     }
+}
 
-    if (argc == 0) {
-        return -1;
+static void prv_echo(const char *s, size_t len) {
+    if (s_echo_len + len > SHELL_ECHO_SZ) {
+        prv_flush_echo();
     }
+    memcpy(&s_echo[s_echo_len], s, len);
+    s_echo_len += len;
+}
 
-    // Match against the command list
-    for (size_t i = 0; i < g_num_shell_commands; i++) {
-        if (!strcasecmp(g_shell_commands[i].name, argv[0])) {
-            // If argc isn't valid for this command, display its help instead.
-            if (((argc - 1) < g_shell_commands[i].min_args) ||
-                ((argc - 1) > g_shell_commands[i].max_args)) {
-                if (g_shell_commands[i].help != NULL) {
-                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[i].help);
-                }
-                return -2;
-            }
-            // Call the command's callback
-            if (g_shell_commands[i].cb != NULL) {
-                printf(NEWLINE);
-                int ret = g_shell_commands[i].cb(argc, argv);
-                if (ret == -2) {
-                    printf(NEWLINE "%s" NEWLINE, g_shell_commands[i].help);
-                }
-                return ret;
-            }
-        }
+static void prv_history_add(void) {
+    const size_t len = s_buf_len + 1;
+    if (s_buf_len == 0 || len >= SHELL_HISTORY_SZ || strcmp(s_history, s_buf) == 0) {
+        return;
     }
+    memmove(&s_history[len], s_history, SHELL_HISTORY_SZ - len);
+    memcpy(s_history, s_buf, len);
 
-    return -1;
+    // Whatever no longer fits (along with the end marker) falls off the end.
+    char *entry = s_history;
+    char *const end = s_history + SHELL_HISTORY_SZ;
+    while (*entry != '\0') {
+        char *nul = memchr(entry, '\0', end - entry);
+        if (nul == NULL || nul + 1 >= end) {
+            *entry = '\0';
+            break;
+        }
+        entry = nul + 1;
+    }
 }
 
-void shell_task(void) {
-#if __EMSCRIPTEN__
-    // This is a terrible hack; ideally this should be handled deeper in the watch library.
-    // Alas, emscripten treats read() as something that should pop up an input box, so I
-    // wasn't able to implement this over there. I sense that this relates to read() being
-    // the wrong way to read data from USB (like we should be using fgets or something), but
-    // until I untangle that, this will have to do.
-    char *received_data = (char*)EM_ASM_INT({
-        var len = lengthBytesUTF8(tx) + 1;
-        var s = _malloc(len);
-        stringToUTF8(tx, s, len);
-        return s;
-    });
-    s_buf_len = min((SHELL_BUF_SZ - 2), strlen(received_data));
-    memcpy(s_buf, received_data, s_buf_len);
-    free(received_data);
-    s_buf[s_buf_len++] = '\n';
-    s_buf[s_buf_len++] = '\0';
-    prv_handle_command();
-    EM_ASM({
-        tx = "";
-    });
-#else
-    // Read one character at a time until we run out.
-    while (true) {
-        if (s_buf_len >= (SHELL_BUF_SZ - 1)) {
-            printf(NEWLINE "Command too long, clearing.");
-            printf(NEWLINE SHELL_PROMPT);
-            s_buf_len = 0;
-            break;
+// Replaces the line being typed with a command from the history, or clears
+// it if we've come back down to the line being typed.
+static void prv_history_move(int8_t direction) {
+    uint8_t pos = s_history_pos + direction;
+    if (direction < 0 && s_history_pos == 0) {
+        return;
+    }
+
+    const char *entry = "";
+    if (pos > 0) {
+        entry = s_history;
+        for (uint8_t i = 1; i < pos && *entry != '\0'; i++) {
+            entry += strlen(entry) + 1;
+        }
+        if (*entry == '\0') {
+            // Nothing further back.
+            return;
         }
+    }
 
-        int c = getchar();
+    s_history_pos = pos;
+    s_buf_len = strlen(entry);
+    memcpy(s_buf, entry, s_buf_len);
 
-        if (c < 0) {
-            // Nothing left to read, we're done.
-            break;
+    // Back to the start of the line, the prompt, the command, then erase to
+    // the end of the line in case the old one was longer.
+    prv_flush_echo();
+    printf("\r" SHELL_PROMPT "%.*s\x1b[K", (int) s_buf_len, s_buf);
+}
+
+// Handles one character of input; returns true once it has run a command.
+static bool prv_handle_char(char c) {
+    const bool last_was_cr = s_last_was_cr;
+    s_last_was_cr = (c == '\r');
+
+    if (s_escape == 1) {
+        s_escape = (c == '[') ? 2 : 0;
+        return false;
+    }
+    if (s_escape == 2) {
+        s_escape = 0;
+        if (c == 'A') {
+            prv_history_move(1);
+        } else if (c == 'B') {
+            prv_history_move(-1);
         }
+        return false;
+    }
 
-        if (c == '\b') {
-            // Handle backspace character.
+    switch (c) {
+        case '\x1b':
+            s_escape = 1;
+            return false;
+        case '\b':
+        case '\x7f':
             // We need to emit a backspace, overwrite the character on the
             // screen with a space, and then backspace again to move the cursor.
             if (s_buf_len > 0) {
-                printf("\b \b");
+                prv_echo("\b \b", 3);
                 s_buf_len--;
             }
-            continue;
-        } else if (c != '\n' && c != '\r') {
-            // Print regular characters to the screen.
-            putchar(c);
-        }
-
-        s_buf[s_buf_len] = c;
-
-        if (c == '\n' || c == '\r') {
-            // Newline! Handle the command.
-            s_buf[s_buf_len+1] = '\0';
+            return false;
+        case '\n':
+            if (last_was_cr) {
+                return false;
+            }
+            // fall through
+        case '\r':
+            prv_flush_echo();
+            s_buf[s_buf_len] = '\0';
+            prv_history_add();
+            s_history_pos = 0;
             (void) prv_handle_command();
             s_buf_len = 0;
             printf(NEWLINE SHELL_PROMPT);
+            return true;
+        default:
+            break;
+    }
+
+    if (s_buf_len >= (SHELL_BUF_SZ - 1)) {
+        prv_flush_echo();
+        printf(NEWLINE "Command too long, clearing.");
+        printf(NEWLINE SHELL_PROMPT);
+        s_buf_len = 0;
+        return false;
+    }
+    s_buf[s_buf_len++] = c;
+    prv_echo(&c, 1);
+    return false;
+}
+
+#endif
+
+bool shell_task(void) {
+#if __EMSCRIPTEN__
+    // This is a terrible hack; ideally this should be handled deeper in the watch library.
+    // Alas, emscripten treats read() as something that should pop up an input box, so I
+    // wasn't able to implement this over there. So the page leaves a whole line in tx,
+    // and we copy it straight into our buffer.
+    s_buf_len = EM_ASM_INT({
+        var len = stringToUTF8(tx, $0, $1);
+        tx = "";
+        return len;
+    }, s_buf, SHELL_BUF_SZ);
+    prv_handle_command();
+    return false;
+#else
+    while (true) {
+        if (s_input_pos == s_input_len) {
+            int len = read(0, s_input, sizeof(s_input));
+            if (len <= 0) {
+                // Nothing left to read, we're done.
+                break;
+            }
+            s_input_pos = 0;
+            s_input_len = len;
+        }
+        if (prv_handle_char(s_input[s_input_pos++])) {
             break;
-        } else {
-            s_buf_len++;
         }
     }
+    prv_flush_echo();
+
+    return s_input_pos < s_input_len;
 #endif
 }
@@ -25,10 +25,14 @@
 #ifndef SHELL_H_
 #define SHELL_H_
 
+#include <stdbool.h>
+
 /** @brief Called periodically from the app loop to handle shell commands.
  *         When a full command is complete, parses and executes its matching
  *         callback.
+ *  @return true if there is more input waiting; it runs at most one command
+ *          per call, so call it again without sleeping.
  */
-void shell_task(void);
+bool shell_task(void);
 
 #endif
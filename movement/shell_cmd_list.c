@@ -27,14 +27,22 @@
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "filesystem.h"
+#include "movement.h"
+#include "shell_transfer.h"
 #include "watch.h"
 
 static int help_cmd(int argc, char *argv[]);
 static int flash_cmd(int argc, char *argv[]);
 static int stress_cmd(int argc, char *argv[]);
+static int boot_cmd(int argc, char *argv[]);
+static int button_cmd(int argc, char *argv[]);
+static int tick_cmd(int argc, char *argv[]);
+static int display_cmd(int argc, char *argv[]);
 
+// Keep this sorted by name: the shell finds commands with a binary search.
 shell_command_t g_shell_commands[] = {
     {
         .name = "?",
@@ -44,25 +52,18 @@ shell_command_t g_shell_commands[] = {
         .cb = help_cmd,
     },
     {
-        .name = "help",
-        .help = "print command list",
-        .min_args = 0,
-        .max_args = 0,
-        .cb = help_cmd,
-    },
-    {
-        .name = "flash",
-        .help = "reboot to UF2 bootloader",
+        .name = "boot",
+        .help = "show how long each stage of boot took",
         .min_args = 0,
         .max_args = 0,
-        .cb = flash_cmd,
+        .cb = boot_cmd,
     },
     {
-        .name = "ls",
-        .help = "usage: ls [PATH]",
-        .min_args = 0,
-        .max_args = 1,
-        .cb = filesystem_cmd_ls,
+        .name = "button",
+        .help = "press or release a button; usage: button {light,mode,alarm} {down,up}",
+        .min_args = 2,
+        .max_args = 2,
+        .cb = button_cmd,
     },
     {
         .name = "cat",
@@ -79,18 +80,18 @@ shell_command_t g_shell_commands[] = {
         .cb = filesystem_cmd_df,
     },
     {
-        .name = "rm",
-        .help = "usage: rm [PATH]",
-        .min_args = 1,
-        .max_args = 1,
-        .cb = filesystem_cmd_rm,
+        .name = "display",
+        .help = "show what's on the display",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = display_cmd,
     },
     {
-        .name = "format",
-        .help = "usage: format YES",
+        .name = "dump",
+        .help = "stream a log to utils/dump_decoder.py; usage: dump {flash,LOG} [OFFSET]",
         .min_args = 1,
-        .max_args = 1,
-        .cb = filesystem_cmd_format,
+        .max_args = 2,
+        .cb = shell_transfer_cmd_dump,
     },
     {
         .name = "echo",
@@ -99,6 +100,62 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "flash",
+        .help = "reboot to UF2 bootloader",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = flash_cmd,
+    },
+    {
+        .name = "format",
+        .help = "usage: format YES",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_format,
+    },
+    {
+        .name = "fsstat",
+        .help = "show flash I/O by file and watch face, then reset the counts",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = filesystem_cmd_fsstat,
+    },
+    {
+        .name = "get",
+        .help = "send a file to utils/shell_transfer.py; usage: get PATH [OFFSET]",
+        .min_args = 1,
+        .max_args = 2,
+        .cb = shell_transfer_cmd_get,
+    },
+    {
+        .name = "help",
+        .help = "print command list",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = help_cmd,
+    },
+    {
+        .name = "ls",
+        .help = "usage: ls [PATH]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = filesystem_cmd_ls,
+    },
+    {
+        .name = "put",
+        .help = "receive a file from utils/shell_transfer.py; usage: put PATH [OFFSET]",
+        .min_args = 1,
+        .max_args = 2,
+        .cb = shell_transfer_cmd_put,
+    },
+    {
+        .name = "rm",
+        .help = "usage: rm [PATH]",
+        .min_args = 1,
+        .max_args = 1,
+        .cb = filesystem_cmd_rm,
+    },
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -106,6 +163,13 @@ shell_command_t g_shell_commands[] = {
         .max_args = 2,
         .cb = stress_cmd,
     },
+    {
+        .name = "tick",
+        .help = "send ticks to the current face and time them; usage: tick [COUNT]",
+        .min_args = 0,
+        .max_args = 1,
+        .cb = tick_cmd,
+    },
 };
 
 const size_t g_num_shell_commands = sizeof(g_shell_commands) / sizeof(shell_command_t);
@@ -129,6 +193,7 @@ static int flash_cmd(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
 
+    filesystem_flush();
     watch_reset_to_bootloader();
     return 0;
 }
@@ -153,6 +218,8 @@ static int stress_cmd(int argc, char *argv[]) {
         delay = atoi(argv[2]);
     }
 
+    uint32_t dropped = watch_get_cdc_stats()->tx_dropped;
+
     for (int i = 0; i < max_len; i++) {
         snprintf(&test_str[i], 2, "%u", (i+1)%10);
         printf("%u:\t%s\r\n", (i+1), test_str);
@@ -161,5 +228,74 @@ static int stress_cmd(int argc, char *argv[]) {
         }
     }
 
+    printf("%lu bytes dropped\r\n", (unsigned long)(watch_get_cdc_stats()->tx_dropped - dropped));
+
+    return 0;
+}
+
+static int boot_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    const watch_boot_times_t *times = watch_get_boot_times();
+    printf("init_mcu:   %6lu us\r\n", (unsigned long)times->init_mcu);
+    printf("app_init:   %6lu us\r\n", (unsigned long)times->app_init);
+    printf("rtc:        %6lu us\r\n", (unsigned long)times->rtc);
+    printf("app_setup:  %6lu us\r\n", (unsigned long)times->app_setup);
+    printf("  faces:    %6lu us\r\n", (unsigned long)movement_get_face_setup_time());
+
+    // the filesystem only mounts when something needs it; if a face did that at boot, it's part of the face setup time.
+    int32_t mount_time = filesystem_get_mount_time();
+    if (mount_time > 0) printf("  mount:    %6ld us\r\n", (long)mount_time);
+    else if (mount_time == 0) printf("  mount:    after boot\r\n");
+    else printf("  mount:    not yet\r\n");
+
+    printf("total:      %6lu us\r\n", (unsigned long)(times->init_mcu + times->app_init + times->rtc + times->app_setup));
+
+    return 0;
+}
+
+static int button_cmd(int argc, char *argv[]) {
+    (void) argc;
+
+    uint8_t pin;
+    if (strcmp(argv[1], "light") == 0) pin = BTN_LIGHT;
+    else if (strcmp(argv[1], "mode") == 0) pin = BTN_MODE;
+    else if (strcmp(argv[1], "alarm") == 0) pin = BTN_ALARM;
+    else return -1;
+
+    if (strcmp(argv[2], "down") == 0) movement_inject_button(pin, true);
+    else if (strcmp(argv[2], "up") == 0) movement_inject_button(pin, false);
+    else return -1;
+
+    return 0;
+}
+
+static int tick_cmd(int argc, char *argv[]) {
+    uint16_t count = argc > 1 ? atoi(argv[1]) : 1;
+    uint32_t face_us;
+
+    uint16_t delivered = movement_inject_ticks(count, &face_us);
+    printf("%u ticks in %lu us\r\n", delivered, (unsigned long)face_us);
+
+    return 0;
+}
+
+static int display_cmd(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    static const char *indicator_names[] = {"signal", "bell", "pm", "24h", "lap"};
+    char display[11];
+
+    // brackets, since leading and trailing spaces matter.
+    watch_get_display_string(display);
+    printf("[%s]", display);
+    if (watch_get_colon()) printf(" colon");
+    for (uint8_t i = 0; i < sizeof(indicator_names) / sizeof(indicator_names[0]); i++) {
+        if (watch_get_indicator(i)) printf(" %s", indicator_names[i]);
+    }
+    printf("\r\n");
+
     return 0;
 }
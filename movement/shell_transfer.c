@@ -0,0 +1,457 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shell_transfer.h"
+#include "filesystem.h"
+#include "datalog.h"
+#include "watch.h"
+#if !__EMSCRIPTEN__
+#include "spiflash.h"
+#endif
+
+#define SLIP_END 0xC0
+#define SLIP_ESC 0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+
+#define SHELL_TRANSFER_HEADER_SIZE 5
+#define SHELL_TRANSFER_CRC_SIZE 2
+
+// the accelerometer data acquisition face keeps a bitmap of used pages in the first four pages of the flash.
+#define SHELL_TRANSFER_FLASH_BITMAP_PAGES 4
+#define SHELL_TRANSFER_FLASH_PAGES 8192
+
+typedef struct {
+    char name[DATALOG_MAX_NAME_LENGTH + 1];
+    shell_transfer_dump_reader_t reader;
+} shell_transfer_dump_source_t;
+
+static shell_transfer_dump_source_t dump_sources[SHELL_TRANSFER_MAX_DUMP_SOURCES];
+
+static uint16_t _shell_transfer_crc(uint16_t crc, const uint8_t *data, uint16_t length) {
+    while (length--) {
+        crc ^= (uint16_t)*data++ << 8;
+        for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static void _shell_transfer_put_byte(uint8_t byte) {
+    if (byte == SLIP_END) {
+        putchar(SLIP_ESC);
+        byte = SLIP_ESC_END;
+    } else if (byte == SLIP_ESC) {
+        putchar(SLIP_ESC);
+        byte = SLIP_ESC_ESC;
+    }
+    putchar(byte);
+}
+
+static void _shell_transfer_put_bytes(const uint8_t *data, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) _shell_transfer_put_byte(data[i]);
+}
+
+void shell_transfer_send(uint8_t type, uint32_t offset, const void *data, uint16_t length) {
+    uint8_t header[SHELL_TRANSFER_HEADER_SIZE] = {type, offset, offset >> 8, offset >> 16, offset >> 24};
+    uint16_t crc = _shell_transfer_crc(0xFFFF, header, sizeof(header));
+    crc = _shell_transfer_crc(crc, data, length);
+    uint8_t trailer[SHELL_TRANSFER_CRC_SIZE] = {crc, crc >> 8};
+
+    putchar(SLIP_END);
+    _shell_transfer_put_bytes(header, sizeof(header));
+    _shell_transfer_put_bytes(data, length);
+    _shell_transfer_put_bytes(trailer, sizeof(trailer));
+    putchar(SLIP_END);
+    fflush(stdout);
+}
+
+#if !__EMSCRIPTEN__
+
+// one decoded frame, either on its way in, or on its way out of a file in get.
+static uint8_t frame[SHELL_TRANSFER_HEADER_SIZE + SHELL_TRANSFER_CHUNK_SIZE + SHELL_TRANSFER_CRC_SIZE];
+
+bool shell_transfer_register_dump(const char *name, shell_transfer_dump_reader_t reader) {
+    shell_transfer_dump_source_t *free_source = NULL;
+    for (uint8_t i = 0; i < SHELL_TRANSFER_MAX_DUMP_SOURCES; i++) {
+        if (dump_sources[i].reader == NULL) {
+            if (free_source == NULL) free_source = &dump_sources[i];
+        } else if (strcmp(dump_sources[i].name, name) == 0) {
+            dump_sources[i].reader = reader;
+            return true;
+        }
+    }
+    if (free_source == NULL) return false;
+
+    strncpy(free_source->name, name, DATALOG_MAX_NAME_LENGTH);
+    free_source->reader = reader;
+    return true;
+}
+
+static void _shell_transfer_send_error(const char *message) {
+    shell_transfer_send(SHELL_TRANSFER_ERROR, 0, message, strlen(message));
+}
+
+static uint32_t _shell_transfer_frame_offset(void) {
+    return frame[1] | ((uint32_t)frame[2] << 8) | ((uint32_t)frame[3] << 16) | ((uint32_t)frame[4] << 24);
+}
+
+// bytes read from USB that haven't been decoded yet.
+static uint8_t rx_buf[256];
+static uint16_t rx_start;
+static uint16_t rx_end;
+
+/// @return the next byte from the host, or -1 if nothing arrived for SHELL_TRANSFER_TIMEOUT seconds.
+static int16_t _shell_transfer_get_byte(void) {
+    if (rx_start == rx_end) {
+        uint8_t last_second = watch_rtc_get_date_time().unit.second;
+        uint8_t idle_seconds = 0;
+        int bytes_read;
+        // read everything the USB side has for us at once, which also keeps its small buffer from filling up.
+        while ((bytes_read = read(0, (char *)rx_buf, sizeof(rx_buf))) <= 0) {
+            uint8_t second = watch_rtc_get_date_time().unit.second;
+            if (second != last_second) {
+                last_second = second;
+                if (++idle_seconds > SHELL_TRANSFER_TIMEOUT) return -1;
+            }
+        }
+        rx_start = 0;
+        rx_end = bytes_read;
+    }
+    return rx_buf[rx_start++];
+}
+
+/// @return the length of the frame received into frame[], without its CRC; 0 if it was damaged; or -1 on timeout.
+static int16_t _shell_transfer_receive(void) {
+    uint16_t length = 0;
+    bool escaped = false;
+    bool overflow = false;
+
+    while (true) {
+        int16_t c = _shell_transfer_get_byte();
+        if (c < 0) return -1;
+
+        if (c == SLIP_END) {
+            // too short to be a frame: the gap between two frames, or something like a stray line ending.
+            if (length < SHELL_TRANSFER_HEADER_SIZE + SHELL_TRANSFER_CRC_SIZE) {
+                length = 0;
+                overflow = false;
+                continue;
+            }
+            if (overflow) return 0;
+            length -= SHELL_TRANSFER_CRC_SIZE;
+            uint16_t crc = frame[length] | (frame[length + 1] << 8);
+            if (_shell_transfer_crc(0xFFFF, frame, length) != crc) return 0;
+            return length;
+        }
+
+        if (c == SLIP_ESC) {
+            escaped = true;
+            continue;
+        }
+        if (escaped) {
+            if (c == SLIP_ESC_END) c = SLIP_END;
+            else if (c == SLIP_ESC_ESC) c = SLIP_ESC;
+            escaped = false;
+        }
+
+        if (length < sizeof(frame)) frame[length++] = c;
+        else overflow = true;
+    }
+}
+
+#endif
+
+int shell_transfer_cmd_put(int argc, char *argv[]) {
+#if __EMSCRIPTEN__
+    (void) argc;
+    (void) argv;
+    printf("put needs a USB connection.\r\n");
+    return -1;
+#else
+    uint32_t offset = 0;
+    filesystem_mode_t mode = FILESYSTEM_MODE_WRITE;
+
+    // to resume, append to whatever made it last time, and tell the host where that ends.
+    if (argc > 2 && atol(argv[2]) > 0) {
+        int32_t size = filesystem_get_file_size(argv[1]);
+        if (size > 0) {
+            offset = size;
+            mode = FILESYSTEM_MODE_APPEND;
+        }
+    }
+
+    filesystem_file_t *file = filesystem_open(argv[1], mode);
+    if (file == NULL) {
+        _shell_transfer_send_error("can't open file");
+        return -1;
+    }
+
+    rx_start = rx_end = 0;
+    shell_transfer_send(SHELL_TRANSFER_ACK, offset, NULL, 0);
+
+    bool done = false;
+    while (!done) {
+        int16_t length = _shell_transfer_receive();
+        // if the host went away, close the file with what we have, so that it can resume later.
+        if (length < 0) break;
+
+        uint8_t type = frame[0];
+        if (type == SHELL_TRANSFER_ERROR) break;
+        if (length == 0 || _shell_transfer_frame_offset() != offset) {
+            shell_transfer_send(SHELL_TRANSFER_NAK, offset, NULL, 0);
+            continue;
+        }
+
+        if (type == SHELL_TRANSFER_DATA) {
+            int32_t chunk = length - SHELL_TRANSFER_HEADER_SIZE;
+            if (filesystem_write(file, frame + SHELL_TRANSFER_HEADER_SIZE, chunk) != chunk) {
+                filesystem_close(file);
+                _shell_transfer_send_error("write failed");
+                return -1;
+            }
+            offset += chunk;
+            shell_transfer_send(SHELL_TRANSFER_ACK, offset, NULL, 0);
+        } else if (type == SHELL_TRANSFER_END) {
+            done = true;
+        }
+    }
+
+    // closing the file is what commits it, so the final ack waits until that has happened.
+    if (!filesystem_close(file)) {
+        _shell_transfer_send_error("close failed");
+        return -1;
+    }
+    if (!done) return -1;
+    shell_transfer_send(SHELL_TRANSFER_ACK, offset, NULL, 0);
+
+    return 0;
+#endif
+}
+
+int shell_transfer_cmd_get(int argc, char *argv[]) {
+#if __EMSCRIPTEN__
+    (void) argc;
+    (void) argv;
+    printf("get needs a USB connection.\r\n");
+    return -1;
+#else
+    uint32_t offset = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+
+    filesystem_file_t *file = filesystem_open(argv[1], FILESYSTEM_MODE_READ);
+    if (file == NULL) {
+        _shell_transfer_send_error("can't open file");
+        return -1;
+    }
+    if (offset > 0 && filesystem_seek(file, offset) != (int32_t)offset) {
+        filesystem_close(file);
+        _shell_transfer_send_error("can't seek");
+        return -1;
+    }
+
+    int ret = 0;
+    while (true) {
+        int32_t length = filesystem_read(file, frame, SHELL_TRANSFER_CHUNK_SIZE);
+        if (length < 0) {
+            _shell_transfer_send_error("read failed");
+            ret = -1;
+            break;
+        }
+        if (length == 0) {
+            shell_transfer_send(SHELL_TRANSFER_END, offset, NULL, 0);
+            break;
+        }
+        shell_transfer_send(SHELL_TRANSFER_DATA, offset, frame, length);
+        offset += length;
+    }
+
+    filesystem_close(file);
+    return ret;
+#endif
+}
+
+#if !__EMSCRIPTEN__
+
+// where the flash reader is: the page that holds the byte at offset in the dump, or -1 past the last one.
+static uint32_t flash_cursor_offset;
+static int16_t flash_cursor_page;
+
+static int16_t _shell_transfer_next_used_page(int16_t page) {
+    uint8_t bitmap = 0;
+    for (int16_t loaded = -1; page < SHELL_TRANSFER_FLASH_PAGES; page++) {
+        if (page / 8 != loaded) {
+            loaded = page / 8;
+            spi_flash_read_data(loaded, &bitmap, 1);
+        }
+        // a page is in use once its bit has been cleared.
+        if (!(bitmap & (0x80 >> (page % 8)))) return page;
+    }
+    return -1;
+}
+
+static void _shell_transfer_rewind_flash(void) {
+    flash_cursor_offset = 0;
+    flash_cursor_page = _shell_transfer_next_used_page(SHELL_TRANSFER_FLASH_BITMAP_PAGES);
+}
+
+static int32_t _shell_transfer_read_flash(uint32_t offset, uint8_t *buf, uint16_t length) {
+    // finding a page means walking the bitmap, so remember where we are; a dump only ever moves forward.
+    if (offset < flash_cursor_offset) _shell_transfer_rewind_flash();
+    while (flash_cursor_page >= 0 && offset >= flash_cursor_offset + SPI_FLASH_PAGE_SIZE) {
+        flash_cursor_page = _shell_transfer_next_used_page(flash_cursor_page + 1);
+        flash_cursor_offset += SPI_FLASH_PAGE_SIZE;
+    }
+    if (flash_cursor_page < 0) return 0;
+
+    uint16_t within = offset - flash_cursor_offset;
+    length = min(length, SPI_FLASH_PAGE_SIZE - within);
+    if (!spi_flash_read_data((uint32_t)flash_cursor_page * SPI_FLASH_PAGE_SIZE + within, buf, length)) return -1;
+    return length;
+}
+
+// the datalog being dumped; segments[0] is the older one.
+static char dump_log_name[DATALOG_MAX_NAME_LENGTH + 1];
+static uint8_t dump_log_segments[2];
+static int32_t dump_log_sizes[2];
+
+static void _shell_transfer_log_segment_name(uint8_t segment, char *filename) {
+    sprintf(filename, "%s.%d", dump_log_name, segment);
+}
+
+/// @return the segment's sequence number, or -1 if it doesn't hold a datalog segment.
+static int64_t _shell_transfer_log_sequence(uint8_t segment) {
+    char filename[DATALOG_MAX_NAME_LENGTH + 3];
+    uint8_t header[8];
+    _shell_transfer_log_segment_name(segment, filename);
+    filesystem_file_t *file = filesystem_open(filename, FILESYSTEM_MODE_READ);
+    if (file == NULL) return -1;
+    bool valid = filesystem_read(file, header, sizeof(header)) == sizeof(header) && header[0] == 'D' && header[1] == 'L';
+    filesystem_close(file);
+    if (!valid) return -1;
+    return header[4] | (header[5] << 8) | (header[6] << 16) | ((uint32_t)header[7] << 24);
+}
+
+static bool _shell_transfer_open_log(const char *name) {
+    if (strlen(name) > DATALOG_MAX_NAME_LENGTH) return false;
+    strcpy(dump_log_name, name);
+
+    int64_t sequences[2] = {_shell_transfer_log_sequence(0), _shell_transfer_log_sequence(1)};
+    if (sequences[0] < 0 && sequences[1] < 0) return false;
+    dump_log_segments[0] = sequences[1] >= 0 && sequences[1] < sequences[0] ? 1 : 0;
+    dump_log_segments[1] = !dump_log_segments[0];
+    for (uint8_t i = 0; i < 2; i++) {
+        char filename[DATALOG_MAX_NAME_LENGTH + 3];
+        _shell_transfer_log_segment_name(dump_log_segments[i], filename);
+        dump_log_sizes[i] = sequences[dump_log_segments[i]] < 0 ? 0 : filesystem_get_file_size(filename);
+    }
+    return true;
+}
+
+static int32_t _shell_transfer_read_log(uint32_t offset, uint8_t *buf, uint16_t length) {
+    for (uint8_t i = 0; i < 2; i++) {
+        // varints don't say where a segment ends, so each one goes out after its size.
+        uint16_t size = dump_log_sizes[i];
+        if (offset < 2) {
+            uint8_t prefix[2] = {size, size >> 8};
+            length = min(length, 2 - offset);
+            memcpy(buf, prefix + offset, length);
+            return length;
+        }
+        offset -= 2;
+
+        if (offset < size) {
+            char filename[DATALOG_MAX_NAME_LENGTH + 3];
+            _shell_transfer_log_segment_name(dump_log_segments[i], filename);
+            filesystem_file_t *file = filesystem_open(filename, FILESYSTEM_MODE_READ);
+            if (file == NULL) return -1;
+            int32_t bytes_read = -1;
+            if (filesystem_seek(file, offset) == (int32_t)offset) bytes_read = filesystem_read(file, buf, min(length, size - offset));
+            filesystem_close(file);
+            return bytes_read;
+        }
+        offset -= size;
+    }
+    return 0;
+}
+
+// a face or the filesystem may have enabled SPI before the dump, and expects to find it still enabled afterwards.
+static bool _shell_transfer_spi_was_enabled;
+
+static void _shell_transfer_release_flash(void) {
+    // put the flash back to sleep, and only let SPI go if it was off before we started.
+    spi_flash_power_down();
+    if (!_shell_transfer_spi_was_enabled) watch_disable_spi();
+}
+
+#endif
+
+int shell_transfer_cmd_dump(int argc, char *argv[]) {
+#if __EMSCRIPTEN__
+    (void) argc;
+    (void) argv;
+    printf("dump needs a USB connection.\r\n");
+    return -1;
+#else
+    uint32_t offset = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+    shell_transfer_dump_reader_t reader = NULL;
+
+    for (uint8_t i = 0; i < SHELL_TRANSFER_MAX_DUMP_SOURCES; i++) {
+        if (dump_sources[i].reader != NULL && strcmp(dump_sources[i].name, argv[1]) == 0) reader = dump_sources[i].reader;
+    }
+    if (reader == NULL && strcmp(argv[1], "flash") == 0) {
+        _shell_transfer_spi_was_enabled = watch_is_spi_enabled();
+        spi_flash_init();
+        uint8_t first;
+        spi_flash_read_data(0, &first, 1);
+        // the face marks the bitmap's own pages used when it first sets up the flash; anything else isn't its data.
+        if ((first & 0xF0) != 0) {
+            _shell_transfer_release_flash();
+            _shell_transfer_send_error("no accelerometer data on flash");
+            return -1;
+        }
+        _shell_transfer_rewind_flash();
+        reader = _shell_transfer_read_flash;
+    }
+    if (reader == NULL && _shell_transfer_open_log(argv[1])) reader = _shell_transfer_read_log;
+    if (reader == NULL) {
+        _shell_transfer_send_error("no such log");
+        return -1;
+    }
+
+    int32_t length;
+    while ((length = reader(offset, frame, SHELL_TRANSFER_CHUNK_SIZE)) > 0) {
+        shell_transfer_send(SHELL_TRANSFER_DATA, offset, frame, length);
+        offset += length;
+    }
+    if (reader == _shell_transfer_read_flash) _shell_transfer_release_flash();
+    if (length < 0) {
+        _shell_transfer_send_error("read failed");
+        return -1;
+    }
+    shell_transfer_send(SHELL_TRANSFER_END, offset, NULL, 0);
+    return 0;
+#endif
+}
@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SHELL_TRANSFER_H_
+#define SHELL_TRANSFER_H_
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Binary file transfer over the USB shell, for the put and get commands; utils/shell_transfer.py is the other end.
+ *
+ * Everything after the command line travels in frames. Each frame is SLIP-encoded (RFC 1055: it starts and ends
+ * with 0xC0, and 0xC0 and 0xDB inside it are sent as 0xDB 0xDC and 0xDB 0xDD), so either side can find the start
+ * of the next frame after anything that isn't one, like the shell echoing the command line. Decoded, a frame is a
+ * type byte, a 32-bit little-endian file offset, up to SHELL_TRANSFER_CHUNK_SIZE bytes of payload, and a 16-bit
+ * little-endian CRC-CCITT of everything before it.
+ *
+ * put PATH [OFFSET]: the watch opens the file and answers with an ack holding the offset it wants data from: 0,
+ * or with a nonzero OFFSET, the size of what's already there, so an interrupted upload can pick up where it
+ * left off. The host then sends data frames one at a time, each at the offset from the last ack; the watch writes
+ * each one and acks the new end of the file, or naks with the offset it still wants if the frame was damaged or
+ * out of place. An end frame closes the file, which is when littlefs commits it, and the watch acks once that's
+ * done. If the host goes quiet for SHELL_TRANSFER_TIMEOUT seconds, the watch keeps what it has and gives up.
+ *
+ * get PATH [OFFSET]: the watch streams the file from OFFSET as data frames without waiting for acks (USB has its
+ * own flow control), then sends an end frame holding the file's size. If a frame is damaged, the host can start
+ * again from the offset of the last good one.
+ *
+ * dump SOURCE [OFFSET]: streams a log the same way get streams a file, so that it can be read out at USB speed
+ * instead of being chirped. SOURCE is one of:
+ *  - flash: the pages of the sensor board's SPI flash that the accelerometer data acquisition face has filled,
+ *    in order, 256 bytes each.
+ *  - the name of a datalog, i.e. thermlog: its segment files, older one first, each sent as its 16-bit
+ *    little-endian size and then its contents.
+ *  - a name that a watch face registered with shell_transfer_register_dump, for a log it keeps in RAM.
+ * utils/dump_decoder.py turns each of these into CSV.
+ *
+ * Either side can send an error frame, with a message as its payload, to give up on a transfer.
+ */
+
+#define SHELL_TRANSFER_CHUNK_SIZE 256
+#define SHELL_TRANSFER_TIMEOUT 5
+#define SHELL_TRANSFER_MAX_DUMP_SOURCES 4
+
+#define SHELL_TRANSFER_DATA 'D'
+#define SHELL_TRANSFER_ACK 'A'
+#define SHELL_TRANSFER_NAK 'N'
+#define SHELL_TRANSFER_END 'E'
+#define SHELL_TRANSFER_ERROR 'X'
+
+/** @brief Sends one frame to the host.
+  * @param type One of the SHELL_TRANSFER_ frame types.
+  * @param offset The file offset the frame refers to.
+  * @param data The payload, or NULL.
+  * @param length The length of the payload, at most SHELL_TRANSFER_CHUNK_SIZE.
+  */
+void shell_transfer_send(uint8_t type, uint32_t offset, const void *data, uint16_t length);
+
+/** @brief Reads part of a log for the dump command.
+  * @param offset Where to start, in bytes from the start of the log.
+  * @param buf Receives the data.
+  * @param length The most to read, at most SHELL_TRANSFER_CHUNK_SIZE.
+  * @return the number of bytes read, which is 0 at the end of the log, or a negative number on error.
+  */
+typedef int32_t (*shell_transfer_dump_reader_t)(uint32_t offset, uint8_t *buf, uint16_t length);
+
+/** @brief Lets the dump command read out a log that a watch face keeps in RAM.
+  * @param name What to call it on the command line. Registering a name again replaces its reader, so it's fine
+  *             to do this in your face's setup function, which runs again after every wake from sleep mode.
+  * @param reader A function that reads the log.
+  * @return true if the log was registered; false if SHELL_TRANSFER_MAX_DUMP_SOURCES are already registered.
+  */
+bool shell_transfer_register_dump(const char *name, shell_transfer_dump_reader_t reader);
+
+int shell_transfer_cmd_put(int argc, char *argv[]);
+int shell_transfer_cmd_get(int argc, char *argv[]);
+int shell_transfer_cmd_dump(int argc, char *argv[]);
+
+#endif // SHELL_TRANSFER_H_
@@ -24,16 +24,11 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "day_night_percentage_face.h"
 #include "watch_utility.h"
+#include "watch_fixed_math.h"
 #include "sunriset.h"
 
-// fmod but handle negatives right
-static double better_fmod(double x, double y) {
-    return fmod(fmod(x, y) + y, y);
-}
-
 static void recalculate(watch_date_time utc_now, day_night_percentage_state_t *state) {
     movement_location_t movement_location = (movement_location_t) watch_get_backup_data(1);
 
@@ -50,9 +45,15 @@ static void recalculate(watch_date_time utc_now, day_night_percentage_state_t *s
     double lat = (double)lat_centi / 100.0;
     double lon = (double)lon_centi / 100.0;
 
-    state->daylen = day_length(utc_now.unit.year + WATCH_RTC_REFERENCE_YEAR, utc_now.unit.month, utc_now.unit.day, lon, lat);
+    double daylen = day_length(utc_now.unit.year + WATCH_RTC_REFERENCE_YEAR, utc_now.unit.month, utc_now.unit.day, lon, lat);
+    double rise, set;
+
+    state->result = sun_rise_set(utc_now.unit.year + WATCH_RTC_REFERENCE_YEAR, utc_now.unit.month, utc_now.unit.day, lon, lat, &rise, &set);
 
-    state->result = sun_rise_set(utc_now.unit.year + WATCH_RTC_REFERENCE_YEAR, utc_now.unit.month, utc_now.unit.day, lon, lat, &state->rise, &state->set);
+    // this only runs once a day; convert to whole seconds so that the per-tick math below is integer-only.
+    state->daylen = daylen * 3600;
+    state->rise = rise * 3600;
+    state->set = set * 3600;
 }
 
 void day_night_percentage_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
@@ -102,17 +103,18 @@ bool day_night_percentage_face_loop(movement_event_t event, movement_settings_t
                 sprintf(buf, "%s%2dEtrnal", weekday, date_time.unit.day);
                 watch_display_string(buf, 0);
             } else {
-                double day_hours_decimal = utc_now.unit.hour + (utc_now.unit.minute + (utc_now.unit.second / 60.0)) / 60.0;
+                int32_t day_seconds = utc_now.unit.hour * 3600 + utc_now.unit.minute * 60 + utc_now.unit.second;
 
-                double day_percentage = (24.0 - better_fmod(state->rise - day_hours_decimal, 24.0)) / state->daylen;
-                double night_percentage = (24.0 - better_fmod(state->set - day_hours_decimal, 24.0)) / (24 - state->daylen);
+                // time elapsed since sunrise and since sunset, in seconds
+                int32_t since_rise = 86400 - watch_fixed_wrap(state->rise - day_seconds, 86400);
+                int32_t since_set = 86400 - watch_fixed_wrap(state->set - day_seconds, 86400);
 
                 uint16_t percentage;
-                if (day_percentage > 0.0 && day_percentage < 1.0) {
-                    percentage = day_percentage * 10000;
+                if (since_rise > 0 && since_rise < state->daylen) {
+                    percentage = (int64_t)since_rise * 10000 / state->daylen;
                     watch_clear_indicator(WATCH_INDICATOR_PM);
                 } else {
-                    percentage = night_percentage * 10000;
+                    percentage = (int64_t)since_set * 10000 / (86400 - state->daylen);
                     watch_set_indicator(WATCH_INDICATOR_PM);
                 }
                 if (event.event_type == EVENT_LOW_ENERGY_UPDATE) {
@@ -44,9 +44,9 @@
 
 typedef struct {
     int result; // -1, 0, 1: result from sun_rise_set, -2: no location set
-    double rise;
-    double set;
-    double daylen;
+    int32_t rise;   // seconds after midnight UTC
+    int32_t set;    // seconds after midnight UTC
+    int32_t daylen; // seconds
 } day_night_percentage_state_t;
 
 void day_night_percentage_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
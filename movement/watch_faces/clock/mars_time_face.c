@@ -24,17 +24,20 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "watch_utility.h"
+#include "watch_fixed_math.h"
 #include "mars_time_face.h"
 
-// note: lander coordinates come from Mars24's `marslandmarks.xml` file
-static double site_longitudes[MARS_TIME_NUM_SITES] = {
+// One Mars solar day is 1.0274912517 Earth days; everything below is in integer microseconds.
+#define MARS_SOL_MICROSECONDS 88775244147LL
+
+// note: lander coordinates come from Mars24's `marslandmarks.xml` file. in millionths of a degree.
+static const int32_t site_longitudes[MARS_TIME_NUM_SITES] = {
     0,                      // Mars Coordinated Time, at the meridian
-    360.0 - 109.9,          // Zhurong lander site
-    360.0 - 77.45088572,    // Perseverance lander site
-    360.0 - 135.623447,     // InSight lander site
-    360.0 - 137.441635,     // Curiosity lander site
+    250100000,              // Zhurong lander site (360 - 109.9)
+    282549114,              // Perseverance lander site (360 - 77.45088572)
+    224376553,              // InSight lander site (360 - 135.623447)
+    222558365,              // Curiosity lander site (360 - 137.441635)
 };
 
 static char site_names[MARS_TIME_NUM_SITES][3] = {
@@ -59,12 +62,11 @@ typedef struct {
     uint8_t second;
 } mars_clock_hms_t;
 
-static void _h_to_hms(mars_clock_hms_t *date_time, double h) {
-	unsigned int seconds = (unsigned int)(h * 3600.0);
+static void _s_to_hms(mars_clock_hms_t *date_time, uint32_t seconds) {
 	date_time->hour = seconds / 3600;
 	seconds = seconds % 3600;
-	date_time->minute = floor(seconds / 60);
-	date_time->second = round(seconds % 60);
+	date_time->minute = seconds / 60;
+	date_time->second = seconds % 60;
 }
 
 static void _update(movement_settings_t *settings, mars_time_state_t *state) {
@@ -73,31 +75,25 @@ static void _update(movement_settings_t *settings, mars_time_state_t *state) {
     uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
     // TODO: I'm skipping over some steps here.
     // https://www.giss.nasa.gov/tools/mars24/help/algorithm.html
-    double jdut = 2440587.5 + ((double)now / 86400.0);
-    double jdtt = jdut + ((37.0 + 32.184) / 86400.0);
-    double jd2k = jdtt - 2451545.0;
-    double msd = ((jd2k - 4.5) / 1.0274912517) + 44796.0 - 0.0009626;
-    double mtc = fmod(24 * msd, 24);
-    double lmt;
-
-    if (state->current_site == 0) {
-        lmt = mtc;
-    } else {
-        double longitude = site_longitudes[state->current_site];
-        double lmst = mtc - ((longitude * 24.0) / 360.0);
-        lmt = fmod(lmst + 24, 24);
-    }
+    // MSD = ((JD_TT - 2451545.0 - 4.5) / 1.0274912517) + 44796.0 - 0.0009626
+    // JD_TT - 2451549.5, in Earth microseconds, is the UNIX time since 1970-01-05 12:00 UTC, plus 37 + 32.184 s.
+    int64_t earth_us = (int64_t)now * 1000000 - 947116730816000LL;
+    int64_t msd_us = earth_us + 44796 * MARS_SOL_MICROSECONDS - 85455050; // 0.0009626 sols
+    uint32_t msd = msd_us / MARS_SOL_MICROSECONDS;
+    // Coordinated Mars Time in Mars milliseconds since midnight, and then local mean solar time for the site.
+    int64_t mtc_ms = (uint64_t)watch_fixed_wrap64(msd_us, MARS_SOL_MICROSECONDS) * 86400000 / MARS_SOL_MICROSECONDS;
+    int64_t lmt_ms = watch_fixed_wrap64(mtc_ms - (int64_t)site_longitudes[state->current_site] * 240 / 1000, 86400000);
 
     if (state->displaying_sol) {
         // TODO: this is not right, mission sol should turn over at midnight local time?
-        uint16_t sol = floor(msd) - landing_sols[state->current_site];
+        uint16_t sol = msd - landing_sols[state->current_site];
         if (sol < 1000) sprintf(&buf[0], "%s  Sol%3d", site_names[state->current_site], sol);
         else sprintf(&buf[0], "%s $%6d", site_names[state->current_site], sol);
         watch_clear_colon();
         watch_clear_indicator(WATCH_INDICATOR_24H);
     } else {
         mars_clock_hms_t mars_time;
-        _h_to_hms(&mars_time, lmt);
+        _s_to_hms(&mars_time, lmt_ms / 1000);
         sprintf(&buf[0], "%s  %02d%02d%02d", site_names[state->current_site], mars_time.hour, mars_time.minute, mars_time.second);
         watch_set_colon();
         watch_set_indicator(WATCH_INDICATOR_24H);
@@ -31,6 +31,7 @@
 #include <string.h>
 #include "activity_face.h"
 #include "chirpy_tx.h"
+#include "shell_transfer.h"
 #include "watch.h"
 #include "watch_utility.h"
 
@@ -171,6 +172,7 @@ static void _activity_clear_buffers() {
 static void _activity_display_choice(activity_state_t *state);
 static void _activity_update_logging_screen(movement_settings_t *settings, activity_state_t *state);
 static uint8_t _activity_get_next_byte(uint8_t *next_byte);
+static int32_t _activity_dump(uint32_t offset, uint8_t *buf, uint16_t length);
 
 void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void)settings;
@@ -181,6 +183,7 @@ void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index
         // This happens only at boot
         _activity_clear_buffers();
     }
+    shell_transfer_register_dump("activity", _activity_dump);
     // Do any pin or peripheral setup here; this will be called whenever the watch wakes from deep sleep.
 }
 
@@ -366,8 +369,51 @@ static void _activity_chirp_tick_countdown(void *context) {
     ++state->chirpy_tick_state.seq_pos;
 }
 
+// The export format, shared by chirping and the shell's dump command: the two-byte prefix, then each
+// logged activity, higher order bytes first.
+static uint16_t _activity_export_size(void) {
+    return CHIRPY_PREFIX_LEN + activity_log_count * sizeof(activity_item_t);
+}
+
+static uint8_t _activity_export_byte(uint16_t pos) {
+    // Two-byte prefix
+    if (pos < CHIRPY_PREFIX_LEN) {
+        return activity_chirpy_prefix[pos];
+    }
+    // Data
+    pos -= CHIRPY_PREFIX_LEN;
+    uint16_t ix = pos / sizeof(activity_item_t);
+    const activity_item_t *itm = &activity_log_buffer[ix];
+    uint16_t ofs = pos % sizeof(activity_item_t);
+
+    // Do this the hard way, byte by byte, to avoid high/low endedness issues
+    // Higher order bytes first, is our serialization format
+    // watch_date_time start_time;
+    // uint16_t total_sec;
+    // uint16_t pause_sec;
+    // uint8_t activity_type;
+    if (ofs == 0)
+        return (itm->start_time.reg & 0xff000000) >> 24;
+    else if (ofs == 1)
+        return (itm->start_time.reg & 0x00ff0000) >> 16;
+    else if (ofs == 2)
+        return (itm->start_time.reg & 0x0000ff00) >> 8;
+    else if (ofs == 3)
+        return (itm->start_time.reg & 0x000000ff);
+    else if (ofs == 4)
+        return (itm->total_sec & 0xff00) >> 8;
+    else if (ofs == 5)
+        return (itm->total_sec & 0x00ff);
+    else if (ofs == 6)
+        return (itm->pause_sec & 0xff00) >> 8;
+    else if (ofs == 7)
+        return (itm->pause_sec & 0x00ff);
+    else
+        return itm->activity_type;
+}
+
 static uint8_t _activity_get_next_byte(uint8_t *next_byte) {
-    uint16_t num_bytes = 2 + activity_log_count * sizeof(activity_item_t);
+    uint16_t num_bytes = _activity_export_size();
     uint16_t pos = *activity_seq_pos;
 
     // Init counter
@@ -379,54 +425,29 @@ static uint8_t _activity_get_next_byte(uint8_t *next_byte) {
     if (pos == num_bytes) {
         return 0;
     }
-    // Two-byte prefix
-    if (pos < 2) {
-        (*next_byte) = activity_chirpy_prefix[pos];
+    // Update counter when starting new item
+    if (pos >= CHIRPY_PREFIX_LEN && (pos - CHIRPY_PREFIX_LEN) % sizeof(activity_item_t) == 0) {
+        uint16_t ix = (pos - CHIRPY_PREFIX_LEN) / sizeof(activity_item_t);
+        sprintf(activity_buf, "%3d", activity_log_count - ix);
+        watch_display_string(activity_buf, 5);
     }
-    // Data
-    else {
-        pos -= 2;
-        uint16_t ix = pos / sizeof(activity_item_t);
-        const activity_item_t *itm = &activity_log_buffer[ix];
-        uint16_t ofs = pos % sizeof(activity_item_t);
-
-        // Update counter when starting new item
-        if (ofs == 0) {
-            sprintf(activity_buf, "%3d", activity_log_count - ix);
-            watch_display_string(activity_buf, 5);
-        }
+    (*next_byte) = _activity_export_byte(pos);
 
-        // Do this the hard way, byte by byte, to avoid high/low endedness issues
-        // Higher order bytes first, is our serialization format
-        uint8_t val;
-        // watch_date_time start_time;
-        // uint16_t total_sec;
-        // uint16_t pause_sec;
-        // uint8_t activity_type;
-        if (ofs == 0)
-            val = (itm->start_time.reg & 0xff000000) >> 24;
-        else if (ofs == 1)
-            val = (itm->start_time.reg & 0x00ff0000) >> 16;
-        else if (ofs == 2)
-            val = (itm->start_time.reg & 0x0000ff00) >> 8;
-        else if (ofs == 3)
-            val = (itm->start_time.reg & 0x000000ff);
-        else if (ofs == 4)
-            val = (itm->total_sec & 0xff00) >> 8;
-        else if (ofs == 5)
-            val = (itm->total_sec & 0x00ff);
-        else if (ofs == 6)
-            val = (itm->pause_sec & 0xff00) >> 8;
-        else if (ofs == 7)
-            val = (itm->pause_sec & 0x00ff);
-        else
-            val = itm->activity_type;
-        (*next_byte) = val;
-    }
     ++(*activity_seq_pos);
     return 1;
 }
 
+// Lets the shell's dump command read the log out over USB, in the same format we chirp.
+static int32_t _activity_dump(uint32_t offset, uint8_t *buf, uint16_t length) {
+    uint16_t num_bytes = _activity_export_size();
+    int32_t count = 0;
+    while (count < length && offset + count < num_bytes) {
+        buf[count] = _activity_export_byte(offset + count);
+        count++;
+    }
+    return count;
+}
+
 static void _activity_finish_logging(activity_state_t *state) {
     // Save this activity
     // If shorter than minimum for log: don't save
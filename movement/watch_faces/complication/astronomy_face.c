@@ -35,6 +35,9 @@
 
 #define NUM_AVAILABLE_BODIES 9
 
+// VSOP87 series to evaluate per EVENT_COMPUTE; each one takes a noticeable fraction of a second on the watch.
+#define ASTRONOMY_STEPS_PER_SLICE 1
+
 static const char astronomy_available_celestial_bodies[NUM_AVAILABLE_BODIES] = {
     ASTRO_BODY_SUN,
     ASTRO_BODY_MERCURY,
@@ -59,7 +62,7 @@ static const char astronomy_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
     "NE"    // Neptune
 };
 
-static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy_state_t *state) {
+static void _astronomy_face_begin_calculation(movement_settings_t *settings, astronomy_state_t *state) {
 #if __EMSCRIPTEN__
     int16_t browser_lat = EM_ASM_INT({
         return lat;
@@ -84,7 +87,14 @@ static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy
     date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
     double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
 
-    astro_equatorial_coordinates_t radec_precession = astro_get_ra_dec(jd, astronomy_available_celestial_bodies[state->active_body_index], state->latitude_radians, state->longitude_radians, true);
+    astro_ra_dec_begin(&state->calculation, jd, astronomy_available_celestial_bodies[state->active_body_index]);
+    movement_request_compute();
+}
+
+static void _astronomy_face_finish_calculation(astronomy_state_t *state) {
+    double jd = state->calculation.jd;
+    // the VSOP87 work is shared; only the cheap final rotation differs between these two.
+    astro_equatorial_coordinates_t radec_precession = astro_ra_dec_finish(&state->calculation, state->latitude_radians, state->longitude_radians, true);
     printf("\nParams to convert: %f %f %f %f %f\n",
             jd,
             astro_radians_to_degrees(state->latitude_radians),
@@ -93,7 +103,7 @@ static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy
             astro_radians_to_degrees(radec_precession.declination));
 
     astro_horizontal_coordinates_t horiz = astro_ra_dec_to_alt_az(jd, state->latitude_radians, state->longitude_radians, radec_precession.right_ascension, radec_precession.declination);
-    astro_equatorial_coordinates_t radec = astro_get_ra_dec(jd, astronomy_available_celestial_bodies[state->active_body_index], state->latitude_radians, state->longitude_radians, false);
+    astro_equatorial_coordinates_t radec = astro_ra_dec_finish(&state->calculation, state->latitude_radians, state->longitude_radians, false);
     state->altitude = astro_radians_to_degrees(horiz.altitude);
     state->azimuth = astro_radians_to_degrees(horiz.azimuth);
     state->right_ascension = astro_radians_to_hms(radec.right_ascension);
@@ -116,7 +126,7 @@ static void _astronomy_face_recalculate(movement_settings_t *settings, astronomy
             state->distance);
 }
 
-static void _astronomy_face_update(movement_event_t event, movement_settings_t *settings, astronomy_state_t *state) {
+static void _astronomy_face_update(movement_event_t event, astronomy_state_t *state) {
     char buf[16];
     switch (state->mode) {
         case ASTRONOMY_MODE_SELECTING_BODY:
@@ -147,13 +157,11 @@ static void _astronomy_face_update(movement_event_t event, movement_settings_t *
             }
             break;
         case ASTRONOMY_MODE_CALCULATING:
-            watch_clear_display();
-             // this takes a moment and locks the UI, flash C for "Calculating"
-            watch_start_character_blink('C', 100);
-            _astronomy_face_recalculate(settings, state);
-            watch_stop_blink();
-            state->mode = ASTRONOMY_MODE_DISPLAYING_ALT;
-            // fall through
+            // the calculation runs in EVENT_COMPUTE slices; show how far along it is.
+            watch_clear_colon();
+            sprintf(buf, "%s  C  %3d", astronomy_celestial_body_names[state->active_body_index], astro_ra_dec_progress(&state->calculation));
+            watch_display_string(buf, 0);
+            break;
         case ASTRONOMY_MODE_DISPLAYING_ALT:
             sprintf(buf, "%saL%6d", astronomy_celestial_body_names[state->active_body_index], (int16_t)round(state->altitude * 100));
             watch_display_string(buf, 0);
@@ -217,7 +225,18 @@ bool astronomy_face_loop(movement_event_t event, movement_settings_t *settings,
     switch (event.event_type) {
         case EVENT_ACTIVATE:
         case EVENT_TICK:
-            _astronomy_face_update(event, settings, state);
+            _astronomy_face_update(event, state);
+            break;
+        case EVENT_COMPUTE:
+            if (state->mode != ASTRONOMY_MODE_CALCULATING) break;
+            movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
+            if (astro_ra_dec_step(&state->calculation, ASTRONOMY_STEPS_PER_SLICE)) {
+                _astronomy_face_finish_calculation(state);
+                state->mode = ASTRONOMY_MODE_DISPLAYING_ALT;
+            } else {
+                movement_request_compute();
+            }
+            _astronomy_face_update(event, state);
             break;
         case EVENT_ALARM_BUTTON_UP:
             switch (state->mode) {
@@ -237,19 +256,21 @@ bool astronomy_face_loop(movement_event_t event, movement_settings_t *settings,
                     state->mode++;
                     break;
             }
-            _astronomy_face_update(event, settings, state);
+            _astronomy_face_update(event, state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             if (state->mode == ASTRONOMY_MODE_SELECTING_BODY) {
-                // celestial body selected! this triggers a calculation in the update method.
+                // celestial body selected! this kicks off a calculation that runs in EVENT_COMPUTE slices.
                 state->mode = ASTRONOMY_MODE_CALCULATING;
                 movement_request_tick_frequency(1);
-                _astronomy_face_update(event, settings, state);
-            } else if (state->mode != ASTRONOMY_MODE_CALCULATING) {
-                // in all modes except "doing a calculation", return to the selection screen.
+                watch_clear_display();
+                _astronomy_face_begin_calculation(settings, state);
+                _astronomy_face_update(event, state);
+            } else {
+                // in all other modes, including an unfinished calculation, return to the selection screen.
                 state->mode = ASTRONOMY_MODE_SELECTING_BODY;
                 movement_request_tick_frequency(4);
-            _astronomy_face_update(event, settings, state);
+                _astronomy_face_update(event, state);
             }
             break;
         case EVENT_TIMEOUT:
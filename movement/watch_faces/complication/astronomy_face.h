@@ -50,8 +50,9 @@
  *     NE - Neptune
  * 
  * Once you’ve selected the celestial body whose parameters you wish to
- * calculate, long press the Alarm button and release it. The letter “C” will
- * flash while the calculation is performed.
+ * calculate, long press the Alarm button and release it. A “C” and a
+ * percentage will show how far along the calculation is. The watch stays
+ * responsive in the meantime; long press Alarm to cancel, or Mode to move on.
  * 
  * When the calculation is complete, the screen will display the altitude
  * (“aL”) of the celestial body. You can cycle through the available parameters
@@ -91,6 +92,7 @@ typedef struct {
     double altitude;    // in decimal degrees
     double azimuth;     // in decimal degrees
     double distance;    // in AU
+    astro_ra_dec_state_t calculation;
 } astronomy_state_t;
 
 void astronomy_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -42,6 +42,14 @@ void blinky_face_activate(movement_settings_t *settings, void *context) {
     state->active = false;
 }
 
+static void _blinky_face_start(blinky_face_state_t *state) {
+    const uint8_t colors[][2] = {{255, 0}, {0, 255}, {255, 255}};
+    // the LED blinks by itself while the watch sleeps, so there's nothing for us to do on each tick. It's ours now,
+    // so a backlight that was about to time out shouldn't turn it off.
+    watch_led_clear_timeout();
+    watch_led_blink(colors[state->color][0], colors[state->color][1], state->fast ? 125 : 500);
+}
+
 static void _blinky_face_update_lcd(blinky_face_state_t *state) {
     char buf[11];
     const char colors[][7] = {" red  ", " Green", " Yello"};
@@ -63,11 +71,14 @@ bool blinky_face_loop(movement_event_t event, movement_settings_t *settings, voi
                 _blinky_face_update_lcd(state);
             }
             break;
+        case EVENT_LIGHT_BUTTON_UP:
+            // the LED is ours while we're on screen; the default handler would turn off the blinking.
+            break;
         case EVENT_ALARM_BUTTON_UP:
             if (!state->active) {
                 state->active = true;
                 watch_clear_display();
-                movement_request_tick_frequency(state->fast ? 8 : 2);            
+                _blinky_face_start(state);
             } else {
                 state->active = false;
                 watch_set_led_off();
@@ -80,14 +91,6 @@ bool blinky_face_loop(movement_event_t event, movement_settings_t *settings, voi
                 _blinky_face_update_lcd(state);
             }
             break;
-        case EVENT_TICK:
-            if (state->active) {
-                if (event.subsecond % 2 == 0) watch_set_led_off();
-                else if (state->color == 0) watch_set_led_red();
-                else if (state->color == 1) watch_set_led_green();
-                else watch_set_led_yellow();
-            }
-            break;
         case EVENT_TIMEOUT:
             if (!state->active) movement_move_to_face(0);
             break;
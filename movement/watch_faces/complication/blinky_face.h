@@ -39,7 +39,8 @@
  * button. A long press on the Alarm button starts the blinking light, and
  * another long press stops it.
  *
- * Note that this will chew through your battery! The green LED uses about
+ * The LED blinks on its own, so the watch still sleeps between blinks; but
+ * note that this will chew through your battery! The green LED uses about
  * 450µA at full brightness, which is 45 times the normal power consumption of
  * the watch. The red LED is an order of magnitude less efficient (4500 µA),
  * and the yellow setting lights both LEDs, which chews through nearly
@@ -30,6 +30,7 @@
 typedef struct {
     uint8_t current_stage;
     bool sound_on;
+    bool light_on;
 } breathing_state_t;
 
 static void beep_in (void);
@@ -57,6 +58,18 @@ void breathing_face_activate(movement_settings_t *settings, void *context) {
     // ...and set the initial state of our watch face.
     state->current_stage = 0;
     state->sound_on = true;
+    state->light_on = false;
+}
+
+// Each breath in or out is four ticks long, and the LED fades through it on its own while the watch sleeps.
+static void _breathing_fade_light(movement_settings_t *settings, bool in) {
+    if (!in) {
+        watch_led_fade_to_color(0, 0, 4000, NULL);
+        return;
+    }
+    watch_led_fade_to_color(settings->bit.led_red_color ? (0xF | settings->bit.led_red_color << 4) : 0,
+                            settings->bit.led_green_color ? (0xF | settings->bit.led_green_color << 4) : 0,
+                            4000, NULL);
 }
 
 const int NOTE_LENGTH = 80;
@@ -126,7 +139,6 @@ void beep_out_hold (void) {
 }
 
 bool breathing_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
-    (void) settings;
     breathing_state_t *state = (breathing_state_t *)context;
 
     switch (event.event_type) {
@@ -141,7 +153,7 @@ bool breathing_face_loop(movement_event_t event, movement_settings_t *settings,
 
             switch (state->current_stage)
             {
-            case 0: { watch_display_string("Breath", 4); if (state->sound_on) beep_in(); } break;
+            case 0: { watch_display_string("Breath", 4); if (state->light_on) _breathing_fade_light(settings, true); if (state->sound_on) beep_in(); } break;
             case 1: watch_display_string("In   3", 4); break;
             case 2: watch_display_string("In   2", 4); break;
             case 3: watch_display_string("In   1", 4); break;
@@ -151,7 +163,7 @@ bool breathing_face_loop(movement_event_t event, movement_settings_t *settings,
             case 6: watch_display_string("Hold 2", 4); break;               
             case 7:  watch_display_string("Hold 1", 4); break;
 
-            case 8: { watch_display_string("Ou t 4", 4); if (state->sound_on) beep_out(); } break;
+            case 8: { watch_display_string("Ou t 4", 4); if (state->light_on) _breathing_fade_light(settings, false); if (state->sound_on) beep_out(); } break;
             case 9: watch_display_string("Ou t 3", 4); break;
             case 10: watch_display_string("Ou t 2", 4); break;
             case 11: watch_display_string("Ou t 1", 4); break;         
@@ -176,6 +188,19 @@ bool breathing_face_loop(movement_event_t event, movement_settings_t *settings,
                 watch_clear_indicator(WATCH_INDICATOR_BELL); 
             }
             break;
+        case EVENT_LIGHT_BUTTON_DOWN:
+            // the LED is ours while we're on screen; don't turn on the backlight.
+            break;
+        case EVENT_LIGHT_BUTTON_UP:
+            state->light_on = !state->light_on;
+            if (state->light_on) {
+                watch_led_clear_timeout();
+                // start breathing with the display; the next breath in or out picks it up from here.
+                _breathing_fade_light(settings, state->current_stage > 0 && state->current_stage <= 8);
+            } else {
+                watch_set_led_off();
+            }
+            break;
         case EVENT_LOW_ENERGY_UPDATE:
             // This low energy mode update occurs once a minute, if the watch face is in the
             // foreground when Movement enters low energy mode. We have the option of supporting
@@ -201,8 +226,8 @@ bool breathing_face_loop(movement_event_t event, movement_settings_t *settings,
 }
 
 void breathing_face_resign(movement_settings_t *settings, void *context) {
-    // our watch face, like most watch faces, has nothing special to do when resigning.
     // watch faces that enable a peripheral or interact with a sensor may want to turn it off here.
     (void) settings;
-    (void) context;
+    breathing_state_t *state = (breathing_state_t *)context;
+    if (state->light_on) watch_set_led_off();
 }
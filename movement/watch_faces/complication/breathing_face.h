@@ -33,7 +33,8 @@
  * concentration in stressful situations.
  *
  * Usage: Timed messages will cycle as long as this face is active.
- * Press ALARM to toggle sound.
+ * Press ALARM to toggle sound, and LIGHT to toggle a light that glows
+ * brighter as you breathe in and fades as you breathe out.
  */
 
 #include "movement.h"
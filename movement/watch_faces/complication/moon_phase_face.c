@@ -30,16 +30,16 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
-#include <math.h>
 #include "moon_phase_face.h"
 #include "watch_utility.h"
 
-#define LUNAR_DAYS 29.53058770576
-#define LUNAR_SECONDS (LUNAR_DAYS * (24 * 60 * 60))
+// all of the lunar cycle math is done in integer milliseconds; 29.53058770576 days is 2551442778 ms.
+#define LUNAR_MILLISECONDS 2551442778ULL
 #define FIRST_MOON 947182440 // Saturday, 6 January 2000 18:14:00 in unix epoch time
 #define NUM_PHASES 8
 
-static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.76529385288, 15.76529385288, 21.14794077932, 23.14794077932, 28.53058770576, 29.53058770576};
+// 0, 1, 6.38264692644, 8.38264692644, 13.76529385288, 15.76529385288, 21.14794077932, 23.14794077932, 28.53058770576 and 29.53058770576 days
+static const uint32_t phase_changes[] = {0, 86400000, 551460694, 724260694, 1189321389, 1362121389, 1827182083, 1999982083, 2465042778, 2551442778};
 
 void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
@@ -61,12 +61,11 @@ static void _update(movement_settings_t *settings, moon_phase_state_t *state, ui
     watch_date_time date_time = watch_rtc_get_date_time();
     uint32_t now = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60) + offset;
     date_time = watch_utility_date_time_from_unix_time(now, movement_timezone_offsets[settings->bit.time_zone] * 60);
-    double currentfrac = fmod(now - FIRST_MOON, LUNAR_SECONDS) / LUNAR_SECONDS;
-    double currentday = currentfrac * LUNAR_DAYS;
+    uint32_t current_ms = ((uint64_t)(now - FIRST_MOON) * 1000) % LUNAR_MILLISECONDS;
     uint8_t phase_index = 0;
 
     for(phase_index = 0; phase_index <= NUM_PHASES; phase_index++) {
-        if (currentday > phase_changes[phase_index] && currentday <= phase_changes[phase_index + 1]) break;
+        if (current_ms > phase_changes[phase_index] && current_ms <= phase_changes[phase_index + 1]) break;
     }
 
     watch_display_string(" ", 0);
@@ -79,7 +78,7 @@ static void _update(movement_settings_t *settings, moon_phase_state_t *state, ui
             sprintf(buf, "%2dCresnt", date_time.unit.day);
             watch_set_pixel(2, 13);
             watch_set_pixel(2, 15);
-            if (currentfrac > 0.125) watch_set_pixel(1, 13);
+            if ((uint64_t)current_ms * 8 > LUNAR_MILLISECONDS) watch_set_pixel(1, 13);
             break;
         case 2:
             sprintf(buf, "%2d 1st q", date_time.unit.day);
@@ -126,7 +125,7 @@ static void _update(movement_settings_t *settings, moon_phase_state_t *state, ui
             sprintf(buf, "%2dCresnt", date_time.unit.day);
             watch_set_pixel(0, 14);
             watch_set_pixel(0, 13);
-            if (currentfrac < 0.875) watch_set_pixel(2, 14);
+            if ((uint64_t)current_ms * 8 < LUNAR_MILLISECONDS * 7) watch_set_pixel(2, 14);
             break;
     }
     watch_display_string(buf, 2);
@@ -28,12 +28,22 @@
 #include "orrery_face.h"
 #include "watch.h"
 #include "watch_utility.h"
-#include "vsop87a_micro.h" // smaller size, less accurate
-#include "vsop87a_milli.h"
 #include "astrolib.h"
 
 #define NUM_AVAILABLE_BODIES 9
 
+static const astro_body_t orrery_celestial_bodies[NUM_AVAILABLE_BODIES] = {
+    ASTRO_BODY_MERCURY,
+    ASTRO_BODY_VENUS,
+    ASTRO_BODY_EARTH,
+    ASTRO_BODY_MOON,
+    ASTRO_BODY_MARS,
+    ASTRO_BODY_JUPITER,
+    ASTRO_BODY_SATURN,
+    ASTRO_BODY_URANUS,
+    ASTRO_BODY_NEPTUNE
+};
+
 static const char orrery_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
     "ME",   // Mercury
     "VE",   // Venus
@@ -46,55 +56,25 @@ static const char orrery_celestial_body_names[NUM_AVAILABLE_BODIES][3] = {
     "NE"    // Neptune
 };
 
-static void _orrery_face_recalculate(movement_settings_t *settings, orrery_state_t *state) {
+static void _orrery_face_begin_calculation(movement_settings_t *settings, orrery_state_t *state) {
     watch_date_time date_time = watch_rtc_get_date_time();
     uint32_t timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
     date_time = watch_utility_date_time_from_unix_time(timestamp, 0);
     double jd = astro_convert_date_to_julian_date(date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
     double et = astro_convert_jd_to_julian_millenia_since_j2000(jd);
-    double r[3] = {0};
 
-    switch(state->active_body_index) {
-        case 0:
-            vsop87a_milli_getMercury(et, r);
-            break;
-        case 1:
-            vsop87a_milli_getVenus(et, r);
-            break;
-        case 2:
-            vsop87a_milli_getEarth(et, r);
-            break;
-        case 3:
-            {
-                 double earth[3];
-                 double emb[3];
-                 vsop87a_milli_getEarth(et, earth);
-                 vsop87a_milli_getEmb(et, emb);
-                 vsop87a_milli_getMoon(earth, emb, r);
-             }
-            break;
-        case 4:
-            vsop87a_milli_getMars(et, r);
-            break;
-        case 5:
-            vsop87a_milli_getJupiter(et, r);
-            break;
-        case 6:
-            vsop87a_milli_getSaturn(et, r);
-            break;
-        case 7:
-            vsop87a_milli_getUranus(et, r);
-            break;
-        case 8:
-            vsop87a_milli_getNeptune(et, r);
-            break;
-    }
-    state->coords[0] = r[0];
-    state->coords[1] = r[1];
-    state->coords[2] = r[2];
+    astro_body_coordinates_begin(&state->calculation, orrery_celestial_bodies[state->active_body_index], et);
+    movement_request_compute();
 }
 
-static void _orrery_face_update(movement_event_t event, movement_settings_t *settings, orrery_state_t *state) {
+static void _orrery_face_finish_calculation(orrery_state_t *state) {
+    astro_cartesian_coordinates_t r = astro_body_coordinates_result(&state->calculation);
+    state->coords[0] = r.x;
+    state->coords[1] = r.y;
+    state->coords[2] = r.z;
+}
+
+static void _orrery_face_update(movement_event_t event, orrery_state_t *state) {
     char buf[11];
     switch (state->mode) {
         case ORRERY_MODE_SELECTING_BODY:
@@ -124,13 +104,11 @@ static void _orrery_face_update(movement_event_t event, movement_settings_t *set
             }
             break;
         case ORRERY_MODE_CALCULATING:
-            watch_clear_display();
-             // this takes a moment and locks the UI, flash C for "Calculating"
-            watch_start_character_blink('C', 100);
-            _orrery_face_recalculate(settings, state);
-            watch_stop_blink();
-            state->mode = ORRERY_MODE_DISPLAYING_X;
-            // fall through
+            // the calculation runs in EVENT_COMPUTE slices; show how many series are left.
+            sprintf(buf, "%s  C  %3d", orrery_celestial_body_names[state->active_body_index],
+                    astro_body_coordinates_num_steps(state->calculation.body) - state->calculation.series);
+            watch_display_string(buf, 0);
+            break;
         case ORRERY_MODE_DISPLAYING_X:
             sprintf(buf, "%s X%6d", orrery_celestial_body_names[state->active_body_index], (int16_t)round(state->coords[0] * 100));
             watch_display_string(buf, 0);
@@ -171,7 +149,18 @@ bool orrery_face_loop(movement_event_t event, movement_settings_t *settings, voi
     switch (event.event_type) {
         case EVENT_ACTIVATE:
         case EVENT_TICK:
-            _orrery_face_update(event, settings, state);
+            _orrery_face_update(event, state);
+            break;
+        case EVENT_COMPUTE:
+            if (state->mode != ORRERY_MODE_CALCULATING) break;
+            movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
+            if (astro_body_coordinates_step(&state->calculation)) {
+                _orrery_face_finish_calculation(state);
+                state->mode = ORRERY_MODE_DISPLAYING_X;
+            } else {
+                movement_request_compute();
+            }
+            _orrery_face_update(event, state);
             break;
         case EVENT_ALARM_BUTTON_UP:
             switch (state->mode) {
@@ -191,19 +180,21 @@ bool orrery_face_loop(movement_event_t event, movement_settings_t *settings, voi
                     state->mode++;
                     break;
             }
-            _orrery_face_update(event, settings, state);
+            _orrery_face_update(event, state);
             break;
         case EVENT_ALARM_LONG_PRESS:
             if (state->mode == ORRERY_MODE_SELECTING_BODY) {
-                // celestial body selected! this triggers a calculation in the update method.
+                // celestial body selected! this kicks off a calculation that runs in EVENT_COMPUTE slices.
                 state->mode = ORRERY_MODE_CALCULATING;
                 movement_request_tick_frequency(1);
-                _orrery_face_update(event, settings, state);
-            } else if (state->mode != ORRERY_MODE_CALCULATING) {
-                // in all modes except "doing a calculation", return to the selection screen.
+                watch_clear_display();
+                _orrery_face_begin_calculation(settings, state);
+                _orrery_face_update(event, state);
+            } else {
+                // in all other modes, including an unfinished calculation, return to the selection screen.
                 state->mode = ORRERY_MODE_SELECTING_BODY;
                 movement_request_tick_frequency(4);
-                _orrery_face_update(event, settings, state);
+                _orrery_face_update(event, state);
             }
             break;
         case EVENT_TIMEOUT:
@@ -53,8 +53,9 @@
  * (0,0,0) in this calculation.
  * 
  * Long press on the Alarm button to calculate the planet’s location, and
- * after a flashing “C” (for Calculating), you will be presented with the
- * planet’s X coordinate in astronomical units. Short press Alarm to cycle
+ * after a “C” (for Calculating) counts down the remaining steps, you will be
+ * presented with the planet’s X coordinate in astronomical units. The watch
+ * stays responsive while it works. Short press Alarm to cycle
  * through the X, Y and Z coordinates, and then long press Alarm to return
  * to planet selection.
  * 
@@ -68,6 +69,7 @@
  */
 
 #include "movement.h"
+#include "astrolib.h"
 
 typedef enum {
     ORRERY_MODE_SELECTING_BODY = 0,
@@ -83,6 +85,7 @@ typedef struct {
     uint8_t active_body_index;
     double coords[3];
     uint8_t animation_state;
+    astro_body_coordinates_state_t calculation;
 } orrery_state_t;
 
 void orrery_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -24,108 +24,86 @@
 
 #include <stdlib.h>
 #include <string.h>
-#include <math.h>
 #include "watch_utility.h"
+#include "watch_fixed_math.h"
 #include "solstice_face.h"
 
-// Find solstice or equinox time in JDE for a given year, via method from Meeus Ch 27
-static double calculate_solstice_equinox(uint16_t year, uint8_t k) {
-    double Y = ((double)year - 2000) / 1000;
-    double approx_terms[4][5] = {
-        {2451623.80984, 365242.37404, 0.05169, -0.00411, -0.00057}, // March equinox
-        {2451716.56767, 365241.62603, 0.00325, 0.00888, -0.00030}, // June solstice
-        {2451810.21715, 365242.01767, -0.11575, 0.00337, 0.00078}, // September equinox
-        {2451900.05952, 365242.74049, -0.06223, -0.00823, 0.00032}, // December solstice
-    };
-    double JDE0 = approx_terms[k][0] + Y * (approx_terms[k][1] + Y * (approx_terms[k][2] + Y * (approx_terms[k][3] + Y * approx_terms[k][4])));
-    double T = (JDE0 - 2451545.0) / 36525;
-    double W = 35999.373 * T - 2.47;
-    double dlambda = 1 + (0.0334 * cos(W * M_PI / 180.0)) + (0.0007 * cos(2 * W * M_PI / 180.0));
-    double correction_terms[25][3] = {
-        {485,324.96,1934.136},
-        {203,337.23,32964.467},
-        {199,342.08,20.186},
-        {182,27.85,445267.112},
-        {156,73.14,45036.886},
-        {136,171.52,22518.443},
-        {77,222.54,65928.934},
-        {74,296.72,3034.906},
-        {70,243.58,9037.513},
-        {58,119.81,33718.147},
-        {52,297.17,150.678},
-        {50,21.02,2281.226},
-        {45,247.54,29929.562},
-        {44,325.15,31555.956},
-        {29,60.93,4443.417},
-        {18,155.12,67555.328},
-        {17,288.79,4562.452},
-        {16,198.04,62894.029},
-        {14,199.76,31436.921},
-        {12,95.39,14577.848},
-        {12,287.11,31931.756},
-        {12,320.81,34777.259},
-        {9,227.73,1222.114},
-        {8,15.45,16859.074},
-    };
-    double S = 0;
-    for (int i = 0; i < 25; i++) {
-        S += correction_terms[i][0] * cos((correction_terms[i][1] + correction_terms[i][2] * T) * M_PI / 180.0);
-    }
-    double JDE = JDE0 + (0.00001 * S) / dlambda;
-
-    return JDE;
+// Meeus Table 27.C, converted for fixed-point math: amplitude, phase in hundredths of a degree, and rate in
+// thousandths of a degree per Julian century.
+static const struct {
+    uint16_t amplitude;
+    uint16_t phase;
+    uint32_t rate;
+} correction_terms[] = {
+    {485, 32496, 1934136},
+    {203, 33723, 32964467},
+    {199, 34208, 20186},
+    {182, 2785, 445267112},
+    {156, 7314, 45036886},
+    {136, 17152, 22518443},
+    {77, 22254, 65928934},
+    {74, 29672, 3034906},
+    {70, 24358, 9037513},
+    {58, 11981, 33718147},
+    {52, 29717, 150678},
+    {50, 2102, 2281226},
+    {45, 24754, 29929562},
+    {44, 32515, 31555956},
+    {29, 6093, 4443417},
+    {18, 15512, 67555328},
+    {17, 28879, 4562452},
+    {16, 19804, 62894029},
+    {14, 19976, 31436921},
+    {12, 9539, 14577848},
+    {12, 28711, 31931756},
+    {12, 32081, 34777259},
+    {9, 22773, 1222114},
+    {8, 1545, 16859074},
+};
+
+// Meeus Table 27.B, in millionths of a day.
+static const int64_t approx_terms[4][5] = {
+    {2451623809840LL, 365242374040LL, 51690, -4110, -570}, // March equinox
+    {2451716567670LL, 365241626030LL, 3250, 8880, -300}, // June solstice
+    {2451810217150LL, 365242017670LL, -115750, 3370, 780}, // September equinox
+    {2451900059520LL, 365242740490LL, -62230, -8230, 320}, // December solstice
+};
+
+// Returns the binary angle phase + rate * T, where T is in Julian centuries with 28 fractional bits.
+static uint16_t _solstice_angle(int32_t phase_centidegrees, uint32_t rate_millidegrees, int64_t t) {
+    // rate * t is in millidegrees * 2^28; 360000 * 2^28 / 65536 = 1474560000
+    uint16_t angle = (uint16_t)(((int64_t)rate_millidegrees * t) / 1474560000LL);
+
+    return angle + watch_fixed_angle_from_centidegrees(phase_centidegrees);
 }
 
-// Convert JDE to Gergorian datetime as per Meeus Ch 7
-static watch_date_time jde_to_date_time(double JDE) {
-    double tmp = JDE + 0.5;
-    double Z = floor(tmp);
-    double F = fmod(tmp, 1);
-    double A;
-    if (Z < 2299161) {
-        A = Z;
-    } else {
-        double alpha = floor((Z - 1867216.25) / 36524.25);
-        A = Z + 1 + alpha - floor(alpha / 4);
-    }
-    double B = A + 1524;
-    double C = floor((B - 122.1) / 365.25);
-    double D = floor(365.25 * C);
-    double E = floor((B - D) / 30.6001);
-    double day = B - D - floor(30.6001 * E) + F;
-    double month;
-    if (E < 14) {
-        month = E - 1;
-    } else {
-        month = E - 13;
+// Find solstice or equinox time in JDE (millionths of a day) for a given year, via method from Meeus Ch 27
+static int64_t calculate_solstice_equinox(uint16_t year, uint8_t k) {
+    // Y is (year - 2000) / 1000, so each step of Horner's method divides by 1000.
+    int32_t y = (int32_t)year - 2000;
+    int64_t JDE0 = approx_terms[k][4];
+    for (int i = 3; i >= 0; i--) {
+        JDE0 = approx_terms[k][i] + JDE0 * y / 1000;
     }
-    double year;
-    if (month > 2) {
-        year = C - 4716;
-    } else {
-        year = C - 4715;
+    // T = (JDE0 - J2000) / 36525 days, with 28 fractional bits; 2^28 / 36525000000 reduces to 2^22 / 570703125
+    int64_t T = ((JDE0 - WATCH_FIXED_JD_J2000) * 4194304) / 570703125;
+    uint16_t W = _solstice_angle(-247, 35999373, T);
+    int32_t dlambda = WATCH_FIXED_Q15_ONE + (watch_fixed_cos(W) * 334) / 10000 + (watch_fixed_cos(W * 2) * 7) / 10000;
+    int32_t S = 0;
+    for (size_t i = 0; i < sizeof(correction_terms) / sizeof(correction_terms[0]); i++) {
+        S += correction_terms[i].amplitude * watch_fixed_cos(_solstice_angle(correction_terms[i].phase, correction_terms[i].rate, T));
     }
+    // 0.00001 * S / dlambda days, where S and dlambda are both Q15
+    int64_t JDE = JDE0 + ((int64_t)S * 10) / dlambda;
 
-    double hours = fmod(day, 1) * 24;
-    double minutes = fmod(hours, 1) * 60;
-    double seconds = fmod(minutes, 1) * 60;
-
-    watch_date_time result = {.unit = {
-        floor(seconds),
-        floor(minutes),
-        floor(hours),
-        floor(day),
-        floor(month),
-        floor(year - 2020)
-    }};
-
-    return result;
+    return JDE;
 }
 
 static void calculate_datetimes(solstice_state_t *state, movement_settings_t *settings) {
     for (int i = 0; i < 4; i++) {
         // TODO: handle DST changes
-        state->datetimes[i] = jde_to_date_time(calculate_solstice_equinox(2020 + state->year, i) + (movement_timezone_offsets[settings->bit.time_zone] / (60.0*24.0)));
+        uint32_t timestamp = watch_fixed_unix_time_from_julian_date(calculate_solstice_equinox(2020 + state->year, i));
+        state->datetimes[i] = watch_utility_date_time_from_unix_time(timestamp, movement_timezone_offsets[settings->bit.time_zone] * 60);
     }
 }
 
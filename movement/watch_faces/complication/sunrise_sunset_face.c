@@ -79,6 +79,9 @@ static void _sunrise_sunset_face_update(movement_settings_t *settings, sunrise_s
     // to deal with this, we set aside the offset in hours, and add it back before converting it to a watch_date_time.
     double hours_from_utc = ((double)movement_timezone_offsets[settings->bit.time_zone]) / 60.0;
 
+    // this is all soft-float math, which finishes a lot sooner with the clock turned up.
+    movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
+
     // we loop twice because if it's after sunset today, we need to recalculate to display values for tomorrow.
     for(int i = 0; i < 2; i++) {
         uint8_t result = sun_rise_set(scratch_time.unit.year + WATCH_RTC_REFERENCE_YEAR, scratch_time.unit.month, scratch_time.unit.day, lon, lat, &rise, &set);
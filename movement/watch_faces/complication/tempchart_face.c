@@ -37,7 +37,7 @@ struct {
 } tempchart_state;
 
 static void tempchart_save(void) {
-    filesystem_write_file("tempchart.ini", (char*)&tempchart_state, sizeof(tempchart_state));
+    filesystem_write_file_cached("tempchart.ini", (char*)&tempchart_state, sizeof(tempchart_state));
 }
 
 void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
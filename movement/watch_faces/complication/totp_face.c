@@ -135,6 +135,7 @@ static void totp_display_code(totp_state_t *totp_state) {
 
     result = div(totp_state->timestamp, totp->period);
     if (result.quot != totp_state->steps) {
+        movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
         totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
         totp_state->steps = result.quot;
     }
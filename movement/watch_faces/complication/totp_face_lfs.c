@@ -131,14 +131,14 @@ static void totp_face_lfs_read_file(char *filename) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
 
-    if (!filesystem_file_exists(filename)) {
+    filesystem_line_reader_t reader;
+    if (!filesystem_line_reader_open(&reader, filename)) {
         printf("TOTP file error: %s\n", filename);
         return;
     }
 
     char line[256];
-    int32_t offset = 0, old_offset = 0;
-    while (old_offset = offset, filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
+    while (filesystem_line_reader_next(&reader, line, sizeof(line)) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
             break;
@@ -168,7 +168,7 @@ static void totp_face_lfs_read_file(char *filename) {
             *param_middle = '\0';
             if (totp_face_lfs_read_param(&totp_records[num_totp_records], param, param_middle + 1)) {
                 if (!strcmp(param, "secret")) {
-                    totp_records[num_totp_records].file_secret_offset = old_offset + (param_middle + 1 - line);
+                    totp_records[num_totp_records].file_secret_offset = reader.line_offset + (param_middle + 1 - line);
                 }
             } else {
                 error = true;
@@ -187,6 +187,8 @@ static void totp_face_lfs_read_file(char *filename) {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    filesystem_line_reader_close(&reader);
 }
 
 void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
@@ -205,18 +207,24 @@ void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index
 
 static uint8_t *totp_face_lfs_get_file_secret(struct totp_record *record) {
     char buffer[BASE32_LEN(MAX_TOTP_SECRET_SIZE) + 1];
-    int32_t file_secret_offset = record->file_secret_offset;
+    int32_t bytes_read = -1;
 
-    /* TODO filesystem_read_line is quite inefficient. Consider writing a new function,
-     * and keeping the file open?
-     */
-    if (!filesystem_read_line(TOTP_FILE, buffer, &file_secret_offset, record->file_secret_length + 1)) {
+    // we know exactly where the secret is, so go straight there and read just that.
+    filesystem_file_t *file = filesystem_open(TOTP_FILE, FILESYSTEM_MODE_READ);
+    if (file != NULL) {
+        if (filesystem_seek(file, record->file_secret_offset) >= 0) {
+            bytes_read = filesystem_read(file, buffer, record->file_secret_length);
+        }
+        filesystem_close(file);
+    }
+    if (bytes_read != record->file_secret_length) {
         /* Shouldn't happen at this point. Return current_secret, which is misleading but will not cause a crash. */
-        printf("TOTP can't read expected secret from totp_uris.txt (failed readline)\n");
+        printf("TOTP can't read expected secret from totp_uris.txt (failed read)\n");
         return current_secret;
     }
+    buffer[bytes_read] = '\0';
     if (base32_decode((unsigned char *)buffer, current_secret) != record->secret_size) {
-        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d; read to %ld\n", buffer, record->file_secret_offset, file_secret_offset);
+        printf("TOTP can't properly decode secret '%s' from totp_uris.txt; failed at offset %d\n", buffer, record->file_secret_offset);
     }
     return current_secret;
 }
@@ -237,6 +245,7 @@ static void totp_face_set_record(totp_lfs_state_t *totp_state, int i) {
         record->period,
         record->algorithm
     );
+    movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
     totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
     totp_state->steps = totp_state->timestamp / record->period;
 }
@@ -269,6 +278,7 @@ static void totp_face_display(totp_lfs_state_t *totp_state) {
 
     div_t result = div(totp_state->timestamp, totp_records[index].period);
     if (result.quot != totp_state->steps) {
+        movement_request_performance_level(MOVEMENT_PERFORMANCE_LEVEL_FASTEST);
         totp_state->current_code = getCodeFromTimestamp(totp_state->timestamp);
         totp_state->steps = result.quot;
     }
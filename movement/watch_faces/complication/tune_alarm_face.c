@@ -152,9 +152,9 @@ static void _abort_quick_ticks(tune_alarm_state_t *state) {
 
 static void _play_tune_preview(uint8_t tune_idx) {
     if (tune_idx == 0) {
-        watch_buzzer_play_sequence(signal_tunes[rand() % NUM_TUNES], NULL);
+        watch_buzzer_play_tune(signal_tunes[rand() % NUM_TUNES], NULL);
     } else {
-        watch_buzzer_play_sequence(signal_tunes[tune_idx - 1], NULL);
+        watch_buzzer_play_tune(signal_tunes[tune_idx - 1], NULL);
     }
 }
 
@@ -27,6 +27,7 @@
 #include "lis2dw_logging_face.h"
 #include "lis2dw.h"
 #include "watch.h"
+#include "watch_utility.h"
 
 // This watch face is just for testing; if we want to build accelerometer support, it will likely have to be part of Movement itself.
 // The watch face only logs events when it is on screen and not in low energy mode, so you should set LE mode to Never when using it
@@ -39,16 +40,15 @@
 static void _lis2dw_logging_face_update_display(movement_settings_t *settings, lis2dw_logger_state_t *logger_state, lis2dw_wakeup_source wakeup_source) {
     char buf[14];
     char time_indication_character;
-    int8_t pos;
     watch_date_time date_time;
 
     if (logger_state->log_ticks) {
-        pos = (logger_state->data_points - 1 - logger_state->display_index) % LIS2DW_LOGGING_NUM_DATA_POINTS;
-        if (pos < 0) {
+        if (!logger_state->have_data_point) {
             watch_clear_colon();
             sprintf(buf, "NO   data ");
         } else {
-            date_time = logger_state->data[pos].timestamp;
+            int32_t *interrupts = logger_state->data_point.values;
+            date_time = watch_utility_date_time_from_unix_time(logger_state->data_point.timestamp, 0);
             watch_set_colon();
             if (settings->bit.clock_mode_24h) {
                 watch_set_indicator(WATCH_INDICATOR_24H);
@@ -59,16 +59,16 @@ static void _lis2dw_logging_face_update_display(movement_settings_t *settings, l
             }
             switch (logger_state->axis_index) {
                 case 0:
-                    sprintf(buf, "3A%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].x_interrupts + logger_state->data[pos].y_interrupts + logger_state->data[pos].z_interrupts);
+                    sprintf(buf, "3A%2d%02d%4ld", date_time.unit.hour, date_time.unit.minute, interrupts[0] + interrupts[1] + interrupts[2]);
                     break;
                 case 1:
-                    sprintf(buf, "XA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].x_interrupts);
+                    sprintf(buf, "XA%2d%02d%4ld", date_time.unit.hour, date_time.unit.minute, interrupts[0]);
                     break;
                 case 2:
-                    sprintf(buf, "YA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].y_interrupts);
+                    sprintf(buf, "YA%2d%02d%4ld", date_time.unit.hour, date_time.unit.minute, interrupts[1]);
                     break;
                 case 3:
-                    sprintf(buf, "ZA%2d%02d%4lu", date_time.unit.hour, date_time.unit.minute, logger_state->data[pos].z_interrupts);
+                    sprintf(buf, "ZA%2d%02d%4ld", date_time.unit.hour, date_time.unit.minute, interrupts[2]);
                     break;
             }
         }
@@ -91,21 +91,18 @@ static void _lis2dw_logging_face_update_display(movement_settings_t *settings, l
     watch_display_string(buf, 0);
 }
 
+static void _lis2dw_logging_face_load_data_point(lis2dw_logger_state_t *logger_state) {
+    logger_state->have_data_point = datalog_get_recent(&logger_state->log, logger_state->display_index, &logger_state->data_point);
+}
+
 static void _lis2dw_logging_face_log_data(lis2dw_logger_state_t *logger_state) {
-    watch_date_time date_time = watch_rtc_get_date_time();
+    datalog_record_t record = {0};
     // we get this call 15 minutes late; i.e. at 6:15 we're logging events for 6:00.
-    // so: if we're at the top of the hour, roll the hour back too (7:00 task logs data for 6:45)
-    if (date_time.unit.minute == 0) date_time.unit.hour = (date_time.unit.hour + 23) % 24;
-
-    // // then roll the minute back.
-    date_time.unit.minute = (date_time.unit.minute + 45) % 60;
-
-    size_t pos = logger_state->data_points % LIS2DW_LOGGING_NUM_DATA_POINTS;
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].x_interrupts = logger_state->x_interrupts_this_hour;
-    logger_state->data[pos].y_interrupts = logger_state->y_interrupts_this_hour;
-    logger_state->data[pos].z_interrupts = logger_state->z_interrupts_this_hour;
-    logger_state->data_points++;
+    record.timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) - 15 * 60;
+    record.values[0] = logger_state->x_interrupts_this_hour;
+    record.values[1] = logger_state->y_interrupts_this_hour;
+    record.values[2] = logger_state->z_interrupts_this_hour;
+    datalog_append(&logger_state->log, &record);
     logger_state->x_interrupts_this_hour = 0;
     logger_state->y_interrupts_this_hour = 0;
     logger_state->z_interrupts_this_hour = 0;
@@ -117,6 +114,8 @@ void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(lis2dw_logger_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_logger_state_t));
+        lis2dw_logger_state_t *logger_state = (lis2dw_logger_state_t *)*context_ptr;
+        datalog_open(&logger_state->log, "lis2dwlog", 3, LIS2DW_LOGGING_SEGMENT_SIZE);
         watch_enable_i2c();
         lis2dw_begin();
         lis2dw_set_low_power_mode(LIS2DW_LP_MODE_2); // lowest power 14-bit mode, 25 Hz is 3.5 µA @ 1.8V w/ low noise, 3µA without
@@ -147,11 +146,14 @@ bool lis2dw_logging_face_loop(movement_event_t event, movement_settings_t *setti
     switch (event.event_type) {
         case EVENT_LIGHT_BUTTON_DOWN:
             logger_state->axis_index = (logger_state->axis_index + 1) % 4;
+            if (!logger_state->log_ticks) _lis2dw_logging_face_load_data_point(logger_state);
             logger_state->log_ticks = 255;
             _lis2dw_logging_face_update_display(settings, logger_state, wakeup_source);
             break;
         case EVENT_ALARM_BUTTON_UP:
             if (logger_state->log_ticks) logger_state->display_index = (logger_state->display_index + 1) % LIS2DW_LOGGING_NUM_DATA_POINTS;
+            // look the record up once here, rather than decoding the log on every tick while it's on screen.
+            _lis2dw_logging_face_load_data_point(logger_state);
             logger_state->log_ticks = 255;
             logger_state->axis_index = 0;
             _lis2dw_logging_face_update_display(settings, logger_state, wakeup_source);
@@ -35,26 +35,22 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "datalog.h"
 
 #define LIS2DW_LOGGING_NUM_DATA_POINTS (96)
-
-typedef struct {
-    watch_date_time timestamp;
-    uint32_t x_interrupts;
-    uint32_t y_interrupts;
-    uint32_t z_interrupts;
-} lis2dw_logger_data_point_t;
+#define LIS2DW_LOGGING_SEGMENT_SIZE (512)
 
 typedef struct {
     uint8_t display_index;  // the index we are displaying on screen
     uint8_t axis_index;     // the index we are displaying on screen
     uint8_t log_ticks;      // when the user taps the ALARM button, we enter log mode
-    int32_t data_points;    // the absolute number of data points logged
+    bool have_data_point;   // whether data_point holds the record at display_index
     uint8_t interrupts[3];  // the number of interrupts we have logged in each of the last 3 minutes
     uint32_t x_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
     uint32_t y_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
     uint32_t z_interrupts_this_hour;  // the number of interrupts we have logged in the last hour
-    lis2dw_logger_data_point_t data[LIS2DW_LOGGING_NUM_DATA_POINTS];
+    datalog_record_t data_point;      // the record at display_index: x, y and z interrupts for one 15 minute period
+    datalog_t log;
 } lis2dw_logger_state_t;
 
 void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -53,6 +53,13 @@ static const char activity_types[][3] = {
     "WL",   // Weight Lifting
 };
 
+// two low beeps when a reading is done.
+static const watch_buzzer_note_t _done_beeps[] = {
+    {BUZZER_NOTE_C4, 125},
+    {BUZZER_NOTE_REST, 50},
+    {BUZZER_NOTE_C4, 125},
+};
+
 static void update(accelerometer_data_acquisition_state_t *state);
 static void update_settings(accelerometer_data_acquisition_state_t *state);
 static void advance_current_setting(accelerometer_data_acquisition_state_t *state);
@@ -84,7 +91,6 @@ void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, ui
         // mark first four pages as used
         buf[0] = 0x0F;
         wait_for_flash_ready();
-        watch_set_pin_level(A3, false);
         spi_flash_command(CMD_ENABLE_WRITE);
         wait_for_flash_ready();
         spi_flash_write_data(0, buf, 256);
@@ -130,11 +136,11 @@ bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_s
                             state->mode = ACCELEROMETER_DATA_ACQUISITION_MODE_SENSING;
                             state->reading_ticks = SECONDS_TO_RECORD + 1;
                             // also beep if the user asked for it
-                            if (state->beep_with_countdown) watch_buzzer_play_note(BUZZER_NOTE_C6, 75);
+                            if (state->beep_with_countdown) watch_buzzer_play_note_async(BUZZER_NOTE_C6, 75, NULL);
                             start_reading(state, settings);
                         } else if (state->countdown_ticks < 3) {
                             // beep for last two ticks before reading
-                            if (state->beep_with_countdown) watch_buzzer_play_note(BUZZER_NOTE_C5, 75);
+                            if (state->beep_with_countdown) watch_buzzer_play_note_async(BUZZER_NOTE_C5, 75, NULL);
                         }
                     }
                     update(state);
@@ -147,9 +153,7 @@ bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_s
                         } else {
                             finish_reading(state);
                             state->mode = ACCELEROMETER_DATA_ACQUISITION_MODE_IDLE;
-                            watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
-                            watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-                            watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
+                            watch_buzzer_play_notes(_done_beeps, sizeof(_done_beeps) / sizeof(_done_beeps[0]), NULL);
                         }
                     }
                     update(state);
@@ -355,15 +359,12 @@ static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
     uint32_t address = 256 * page;
 
     wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
     spi_flash_command(CMD_ENABLE_WRITE);
     wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
     spi_flash_write_data(address, buf, 256);
     wait_for_flash_ready();
 
     uint8_t buf2[256];
-    watch_set_pin_level(A3, false);
     spi_flash_read_data(address, buf2, 256);
     wait_for_flash_ready();
 
@@ -380,26 +381,21 @@ static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
         }
     }
 
-    watch_set_pin_level(A3, false);
     spi_flash_read_data(header_page * 256, used_pages, 256);
     used_pages[offset_in_buf] = used_byte;
-    watch_set_pin_level(A3, false);
     spi_flash_command(CMD_ENABLE_WRITE);
     wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
     spi_flash_write_data(header_page * 256, used_pages, 256);
     wait_for_flash_ready();
 }
 
 static bool wait_for_flash_ready(void) {
-    watch_set_pin_level(A3, false);
-    bool ok = true;
-    uint8_t read_status_response[1] = {0x00};
+    // ask the chip itself: the driver only knows about the programs and erases it started, and we send some raw.
+    bool ok;
+    uint8_t status = 0;
     do {
-        ok = spi_flash_read_command(CMD_READ_STATUS, read_status_response, 1);
-    } while ((read_status_response[0] & 0x3) != 0);
-    delay_ms(1); // why do i need this?
-    watch_set_pin_level(A3, true);
+        ok = spi_flash_read_command(CMD_READ_STATUS, &status, 1);
+    } while (ok && (status & 0x01));
     return ok;
 }
 
@@ -27,31 +27,34 @@
 #include "thermistor_logging_face.h"
 #include "thermistor_driver.h"
 #include "watch.h"
+#include "watch_utility.h"
+
+static void _thermistor_logging_face_load_data_point(thermistor_logger_state_t *logger_state) {
+    logger_state->have_data_point = datalog_get_recent(&logger_state->log, logger_state->display_index, &logger_state->data_point);
+}
 
 static void _thermistor_logging_face_log_data(thermistor_logger_state_t *logger_state) {
     thermistor_driver_enable();
-    watch_date_time date_time = watch_rtc_get_date_time();
-    size_t pos = logger_state->data_points % THERMISTOR_LOGGING_NUM_DATA_POINTS;
-
-    logger_state->data[pos].timestamp.reg = date_time.reg;
-    logger_state->data[pos].temperature_c = thermistor_driver_get_temperature();
-    logger_state->data_points++;
-
+    float temperature_c = thermistor_driver_get_temperature();
     thermistor_driver_disable();
+
+    datalog_record_t record = {0};
+    record.timestamp = watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0);
+    record.values[0] = (int32_t)(temperature_c * 100 + (temperature_c < 0 ? -0.5f : 0.5f));
+    datalog_append(&logger_state->log, &record);
 }
 
 static void _thermistor_logging_face_update_display(thermistor_logger_state_t *logger_state, bool clock_mode_24h) {
-    int8_t pos = (logger_state->data_points - 1 - logger_state->display_index) % THERMISTOR_LOGGING_NUM_DATA_POINTS;
     char buf[14];
 
     watch_clear_indicator(WATCH_INDICATOR_24H);
     watch_clear_indicator(WATCH_INDICATOR_PM);
     watch_clear_colon();
 
-    if (pos < 0) {
+    if (!logger_state->have_data_point) {
         sprintf(buf, "TL%2dno dat", logger_state->display_index);
     } else if (logger_state->ts_ticks) {
-        watch_date_time date_time = logger_state->data[pos].timestamp;
+        watch_date_time date_time = watch_utility_date_time_from_unix_time(logger_state->data_point.timestamp, 0);
         watch_set_colon();
         if (clock_mode_24h) {
             watch_set_indicator(WATCH_INDICATOR_24H);
@@ -62,7 +65,7 @@ static void _thermistor_logging_face_update_display(thermistor_logger_state_t *l
         }
         sprintf(buf, "AT%2d%2d%02d%02d", date_time.unit.day, date_time.unit.hour, date_time.unit.minute, date_time.unit.second);
     } else {
-        sprintf(buf, "TL%2d%4.1f#C", logger_state->display_index, logger_state->data[pos].temperature_c);
+        sprintf(buf, "TL%2d%4.1f#C", logger_state->display_index, logger_state->data_point.values[0] / 100.0f);
     }
 
     watch_display_string(buf, 0);
@@ -74,6 +77,8 @@ void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_
     if (*context_ptr == NULL) {
         *context_ptr = malloc(sizeof(thermistor_logger_state_t));
         memset(*context_ptr, 0, sizeof(thermistor_logger_state_t));
+        thermistor_logger_state_t *logger_state = (thermistor_logger_state_t *)*context_ptr;
+        datalog_open(&logger_state->log, "thermlog", 1, THERMISTOR_LOGGING_SEGMENT_SIZE);
     }
 }
 
@@ -82,6 +87,7 @@ void thermistor_logging_face_activate(movement_settings_t *settings, void *conte
     thermistor_logger_state_t *logger_state = (thermistor_logger_state_t *)context;
     logger_state->display_index = 0;
     logger_state->ts_ticks = 0;
+    _thermistor_logging_face_load_data_point(logger_state);
 }
 
 bool thermistor_logging_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
@@ -101,6 +107,7 @@ bool thermistor_logging_face_loop(movement_event_t event, movement_settings_t *s
         case EVENT_ALARM_BUTTON_DOWN:
             logger_state->display_index = (logger_state->display_index + 1) % THERMISTOR_LOGGING_NUM_DATA_POINTS;
             logger_state->ts_ticks = 0;
+            _thermistor_logging_face_load_data_point(logger_state);
             // fall through
         case EVENT_ACTIVATE:
             _thermistor_logging_face_update_display(logger_state, settings->bit.clock_mode_24h);
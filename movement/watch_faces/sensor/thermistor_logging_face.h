@@ -29,7 +29,8 @@
  * THERMISTOR LOGGING (aka Temperature Log)
  *
  * This watch face automatically logs the temperature once an hour, and
- * maintains a 36-hour log of readings. This watch face is admittedly rather
+ * lets you browse the last 36 hours of readings. The log is kept on the
+ * filesystem, so it survives a reset. This watch face is admittedly rather
  * complex, and bears some explanation.
  *
  * The main display shows the letters “TL” in the top left, indicating the
@@ -55,19 +56,17 @@
 
 #include "movement.h"
 #include "watch.h"
+#include "datalog.h"
 
 #define THERMISTOR_LOGGING_NUM_DATA_POINTS (36)
-
-typedef struct {
-    watch_date_time timestamp;
-    float temperature_c;
-} thermistor_logger_data_point_t;
+#define THERMISTOR_LOGGING_SEGMENT_SIZE (256)
 
 typedef struct {
     uint8_t display_index;  // the index we are displaying on screen
     uint8_t ts_ticks;       // when the user taps the LIGHT button, we show the timestamp for a few ticks.
-    int32_t data_points;    // the absolute number of data points logged
-    thermistor_logger_data_point_t data[THERMISTOR_LOGGING_NUM_DATA_POINTS];
+    bool have_data_point;   // whether data_point holds the reading at display_index
+    datalog_record_t data_point; // timestamp, and temperature in hundredths of a degree C
+    datalog_t log;
 } thermistor_logger_state_t;
 
 void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -142,7 +142,7 @@ void nanosec_save(void) {
         apply_RTC_correction(nanosec_state.freq_correction * 1.0f * dithering / 100); // Will be divided by dithering inside, final resolution is mere 1ppm
     }
 
-    filesystem_write_file("nanosec.ini", (char*)&nanosec_state, sizeof(nanosec_state));
+    filesystem_write_file_cached("nanosec.ini", (char*)&nanosec_state, sizeof(nanosec_state));
     nanosec_changed = false;
 }
 
@@ -26,6 +26,7 @@
 #include <string.h>
 #include "save_load_face.h"
 #include "filesystem.h"
+#include "kvstore.h"
 
 static void save(save_load_state_t *state) {
     savefile_t savefile = {
@@ -41,9 +42,14 @@ static void save(save_load_state_t *state) {
         watch_rtc_get_date_time(),
     };
     state->slot[state->index] = savefile;
-    char filename[23];
-    sprintf(filename, "save_load_face_%d.bin", state->index);
-    filesystem_write_file(filename, (char*)&savefile, sizeof(savefile_t));
+    char key[KVSTORE_MAX_KEY_LENGTH + 1];
+    sprintf(key, "save_load_%d", state->index);
+    if (!kvstore_put(key, &savefile, sizeof(savefile_t))) {
+        // the key-value store is off while a filesystem from older firmware is in its rows; keep using the file.
+        char filename[23];
+        sprintf(filename, "save_load_face_%d.bin", state->index);
+        filesystem_write_file_cached(filename, (char*)&savefile, sizeof(savefile_t));
+    }
 }
 
 static void load(save_load_state_t *state, movement_settings_t *settings) {
@@ -60,13 +66,19 @@ static void load(save_load_state_t *state, movement_settings_t *settings) {
 
 static void load_saves_to_state(save_load_state_t *state) {
     for (uint8_t i = 0; i < SAVE_LOAD_SLOTS; i++) {
-        char filename[23];
-        sprintf(filename, "save_load_face_%d.bin", i);
-        if (filesystem_get_file_size(filename) != sizeof(savefile_t)) {
-            state->slot[i].version = 0;
-            continue;
+        char key[KVSTORE_MAX_KEY_LENGTH + 1];
+        sprintf(key, "save_load_%d", i);
+        if (kvstore_get(key, &state->slot[i], sizeof(savefile_t)) != sizeof(savefile_t)) {
+            // older firmware kept each slot in a file; move it over to the key-value store.
+            char filename[23];
+            sprintf(filename, "save_load_face_%d.bin", i);
+            if (filesystem_get_file_size(filename) != sizeof(savefile_t) ||
+                !filesystem_read_file(filename, (char*)&state->slot[i], sizeof(savefile_t))) {
+                state->slot[i].version = 0;
+                continue;
+            }
+            if (kvstore_put(key, &state->slot[i], sizeof(savefile_t))) filesystem_rm(filename);
         }
-        filesystem_read_file(filename, (char*)&state->slot[i], sizeof(savefile_t));
         if (state->slot[i].version != 1) {
             state->slot[i].version = 0;
         }
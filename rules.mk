@@ -8,6 +8,10 @@ SUBMODULES = tinyusb
 
 COBRA = cobra -f
 
+TUNES = python3 $(TOP)/utils/tune_converter.py
+GENERATED = $(addprefix $(BUILD)/, $(notdir $(TUNE_SOURCES:.txt=.c)))
+vpath %.txt $(sort $(dir $(TUNE_SOURCES)))
+
 ifndef EMSCRIPTEN
 all: $(BUILD)/$(BIN).elf $(BUILD)/$(BIN).hex $(BUILD)/$(BIN).bin $(BUILD)/$(BIN).uf2 size
 else
@@ -45,10 +49,18 @@ $(SUBMODULES):
 install:
 	@$(UF2) -D $(BUILD)/$(BIN).uf2
 
-$(BUILD)/%.o: | $(SUBMODULES) directory
+$(BUILD)/%.o: | $(SUBMODULES) directory $(GENERATED)
 	@echo CC $@
 	@$(CC) $(CFLAGS) $(filter %/$(subst .o,.c,$(notdir $@)), $(SRCS)) -c -o $@
 
+# tunes are converted every time, since the selection in TUNE_FLAGS may have changed, but the converter only
+# touches its output when it does, so nothing gets recompiled otherwise.
+$(BUILD)/%.c: %.txt $(TOP)/utils/tune_converter.py FORCE | directory
+	@$(TUNES) $< -o $@ $(TUNE_FLAGS)
+
+.SECONDARY: $(GENERATED)
+FORCE:
+
 directory:
 	@$(MKDIR) -p $(BUILD)
 
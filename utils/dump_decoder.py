@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Streams a log off the watch with the shell's dump command, and decodes it to text.
+
+    dump_decoder.py PORT SOURCE [--raw FILE] [--format FORMAT]
+    dump_decoder.py --from FILE --format FORMAT
+
+SOURCE is one of:
+    flash       the accelerometer data acquisition face's pages on the sensor board's SPI flash. The output is
+                what process_motion_dump.py expects, so you can pipe one into the other:
+                    dump_decoder.py /dev/ttyACM0 flash | motion_express_utilities/process_motion_dump.py
+    activity    the activity face's list of recorded activities.
+    LOG         any datalog on the filesystem, by name (i.e. tmp for the temperature logging face), as CSV.
+
+--raw saves the undecoded stream as well, and --from decodes one saved earlier, without a watch. The format
+is normally worked out from SOURCE; with --from, or for a datalog named flash or activity, give it with
+--format. The stream format of each source is described with the dump command in movement/shell_transfer.h.
+"""
+import argparse
+import datetime
+import struct
+import sys
+
+from shell_transfer import Link, TransferError, receive
+
+PAGE_SIZE = 256
+RECORD_SIZE = 8
+
+ACCELEROMETER_DATA_ACQUISITION_HEADER = 1
+ACCELEROMETER_DATA_ACQUISITION_DATA = 3
+
+# by LIS2DW range setting: (range in g, mg per digit in low power mode 1, mg per digit otherwise)
+RANGES = {0: (2, 0.976, 0.244), 1: (4, 1.952, 0.488), 2: (8, 3.904, 0.976), 3: (16, 7.808, 1.952)}
+FILTERS = {0: 2, 1: 4, 2: 10, 3: 20}
+
+ACTIVITIES = ['Bike', 'Walk', 'Run', 'Dance', 'Yoga', 'CrossFit', 'Swim', 'Elliptical', 'Gym', 'Rowing',
+              'Soccer', 'Football', 'Ball', 'Ski']
+
+
+def decode_flash(data, out):
+    """Mirrors print_records in apps/spi-test/app.c, which this replaces."""
+    timestamp = 0
+    range_setting = 0
+    printing_header = False
+    for page in range(0, len(data) - PAGE_SIZE + 1, PAGE_SIZE):
+        for position in range(page, page + PAGE_SIZE, RECORD_SIZE):
+            record, = struct.unpack_from('<Q', data, position)
+            record_type = record & 0x3
+            if record_type == ACCELEROMETER_DATA_ACQUISITION_HEADER:
+                printing_header = True
+                timestamp = record >> 32
+                range_setting = (record >> 2) & 0x3
+                out.write('%c%c.%d.' % (data[position + 2], data[position + 3], timestamp))
+            elif record_type == ACCELEROMETER_DATA_ACQUISITION_DATA:
+                lpmode = (record >> 16) & 0x3
+                g, lsb_lp1, lsb = RANGES[range_setting]
+                if lpmode == 0:
+                    lsb = lsb_lp1
+                if printing_header:
+                    printing_header = False
+                    out.write('RANGE%d_LP%d_FILT%d.CSV\n' % (g, lpmode + 1, FILTERS[(record >> 32) & 0x3]))
+                    out.write('timestamp,accX,accY,accZ\n')
+                counter = record >> 48
+                x = (record >> 2) & 0x3FFF
+                y = (record >> 18) & 0x3FFF
+                z = (record >> 34) & 0x3FFF
+                out.write('%d,%f,%f,%f\n' % ((timestamp * 100 + counter) * 10,
+                                             *(9.80665 * (v - 8192) * lsb / 1000 for v in (x, y, z))))
+    out.write('=== END ===\n')
+
+
+def read_varint(data, position):
+    result = 0
+    shift = 0
+    while True:
+        byte = data[position]
+        position += 1
+        result |= (byte & 0x7F) << shift
+        shift += 7
+        if not byte & 0x80:
+            return result, position
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def decode_log(data, out):
+    """Each segment goes out as a 16-bit size and then the segment file, oldest first; see movement/datalog.h."""
+    position = 0
+    header_written = False
+    while position + 2 <= len(data):
+        size, = struct.unpack_from('<H', data, position)
+        position += 2
+        segment = data[position:position + size]
+        position += size
+        if len(segment) < 8 or segment[:2] != b'DL':
+            continue
+        channels = segment[3]
+        if not header_written:
+            out.write('timestamp,time,%s\n' % ','.join('value%d' % i for i in range(channels)))
+            header_written = True
+        # the first record in each segment is relative to zero.
+        values = [0] * (channels + 1)
+        i = 8
+        try:
+            while i < len(segment):
+                for channel in range(channels + 1):
+                    delta, i = read_varint(segment, i)
+                    values[channel] += unzigzag(delta)
+                when = datetime.datetime.fromtimestamp(values[0] & 0xFFFFFFFF, datetime.timezone.utc)
+                out.write('%d,%s,%s\n' % (values[0] & 0xFFFFFFFF, when.strftime('%Y-%m-%d %H:%M:%S'),
+                                          ','.join(str(v) for v in values[1:])))
+        except IndexError:
+            # the last record was still being written when the segment was read.
+            pass
+
+
+def decode_activity(data, out):
+    """The same export the activity face chirps; see _activity_export_byte in activity_face.c."""
+    if len(data) < 2 or data[0] != 0x27 or data[1] != 0x00:
+        raise TransferError("this doesn't look like an activity export")
+    out.write('start,activity,total_sec,paused_sec\n')
+    for position in range(2, len(data) - 8, 9):
+        reg, total, paused, activity = struct.unpack_from('>IHHB', data, position)
+        start = '%04d-%02d-%02d %02d:%02d:%02d' % ((reg >> 26) + 2020, (reg >> 22) & 0xF, (reg >> 17) & 0x1F,
+                                                   (reg >> 12) & 0x1F, (reg >> 6) & 0x3F, reg & 0x3F)
+        name = ACTIVITIES[activity] if activity < len(ACTIVITIES) else str(activity)
+        out.write('%s,%s,%d,%d\n' % (start, name, total, paused))
+
+
+DECODERS = {'flash': decode_flash, 'log': decode_log, 'activity': decode_activity}
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stream a log off the watch and decode it.")
+    parser.add_argument('port', nargs='?', help='serial port, i.e. /dev/ttyACM0')
+    parser.add_argument('source', nargs='?', help='flash, activity, or the name of a datalog')
+    parser.add_argument('--raw', metavar='FILE', help='also save the undecoded stream here')
+    parser.add_argument('--from', dest='saved', metavar='FILE', help='decode a stream saved with --raw')
+    parser.add_argument('--format', choices=sorted(DECODERS), help='how to decode it')
+    args = parser.parse_args()
+
+    if args.saved:
+        if not args.format:
+            parser.error('--from needs --format')
+        with open(args.saved, 'rb') as f:
+            data = f.read()
+    else:
+        if not args.port or not args.source:
+            parser.error('need a port and a source')
+        chunks = []
+        link = Link(args.port)
+        try:
+            receive(link, 'dump ' + args.source, 0, chunks.append)
+        except TransferError as e:
+            sys.stderr.write('\n%s\n' % e)
+            return 1
+        finally:
+            link.close()
+        sys.stderr.write('\n')
+        data = b''.join(chunks)
+        if args.raw:
+            with open(args.raw, 'wb') as f:
+                f.write(data)
+
+    decoder = DECODERS[args.format or (args.source if args.source in DECODERS else 'log')]
+    try:
+        decoder(data, sys.stdout)
+    except TransferError as e:
+        sys.stderr.write('%s\n' % e)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Runs a scripted UI scenario on the watch over the USB shell, and times each step.
+
+    shell_scenario.py PORT SCENARIO
+
+SCENARIO is a text file with one shell command per line, i.e.
+
+    button mode down
+    button mode up
+    display
+    tick 10
+    sleep 0.6
+
+Blank lines and lines starting with # are skipped, and sleep SECONDS waits here without sending anything (for
+long presses). Each command's output is printed with the time from sending it to getting the prompt back. A
+button command returns before the face has seen the press, but the watch handles it before it reads the next
+command, so a display right after it shows the face's response. tick reports how long the face itself took.
+"""
+import argparse
+import sys
+import time
+
+from shell_transfer import Link, TransferError
+
+PROMPT = b'swsh> '
+
+
+def run(link, line, timeout=5):
+    link.command(line)
+    started = time.monotonic()
+    output = b''
+    deadline = started + timeout
+    while not output.endswith(PROMPT):
+        data = link.read_some(max(0, deadline - time.monotonic()))
+        if not data:
+            raise TransferError('no prompt after ' + line)
+        output += data
+    elapsed = time.monotonic() - started
+    # drop the echo of our command, and the prompt.
+    lines = output[:-len(PROMPT)].decode(errors='replace').replace('\r', '').split('\n')
+    return [l for l in lines[1:] if l], elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Run a scripted UI scenario on the watch.')
+    parser.add_argument('port', help='serial port, i.e. /dev/ttyACM0')
+    parser.add_argument('scenario', help='file with one shell command per line')
+    args = parser.parse_args()
+
+    with open(args.scenario) as f:
+        steps = [line.strip() for line in f if line.strip() and not line.startswith('#')]
+
+    link = Link(args.port)
+    try:
+        for step in steps:
+            if step.startswith('sleep '):
+                time.sleep(float(step.split()[1]))
+                continue
+            output, elapsed = run(link, step)
+            print('%8.1f ms  %s' % (elapsed * 1000, step))
+            for line in output:
+                print('            ' + line)
+    except TransferError as e:
+        sys.stderr.write('%s\n' % e)
+        return 1
+    finally:
+        link.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
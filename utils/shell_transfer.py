@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""Copies files to and from the watch's filesystem over the USB shell, using its put and get commands.
+
+    shell_transfer.py PORT put LOCAL REMOTE [--resume]
+    shell_transfer.py PORT get REMOTE LOCAL [--resume]
+
+PORT is the watch's serial port, i.e. /dev/ttyACM0 or /dev/cu.usbmodem1101. With --resume, a put carries on
+from however much of the file is already on the watch, and a get from however much of it is already here.
+Files whose names start with ext/ live on the sensor board's SPI flash, in builds that have it.
+
+The frame format is described in movement/shell_transfer.h. This only needs the standard library, so it works
+on Linux and macOS; other tools (like dump_decoder.py) import Link from here.
+"""
+import argparse
+import os
+import select
+import struct
+import sys
+import termios
+import time
+import tty
+
+SLIP_END = 0xC0
+SLIP_ESC = 0xDB
+SLIP_ESC_END = 0xDC
+SLIP_ESC_ESC = 0xDD
+
+CHUNK_SIZE = 256
+TIMEOUT = 5
+RETRIES = 5
+
+DATA = ord('D')
+ACK = ord('A')
+NAK = ord('N')
+END = ord('E')
+ERROR = ord('X')
+
+
+def crc16(data, crc=0xFFFF):
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+        crc &= 0xFFFF
+    return crc
+
+
+def encode_frame(frame_type, offset, payload=b''):
+    body = struct.pack('<BI', frame_type, offset) + payload
+    body += struct.pack('<H', crc16(body))
+    escaped = body.replace(bytes([SLIP_ESC]), bytes([SLIP_ESC, SLIP_ESC_ESC]))
+    escaped = escaped.replace(bytes([SLIP_END]), bytes([SLIP_ESC, SLIP_ESC_END]))
+    return bytes([SLIP_END]) + escaped + bytes([SLIP_END])
+
+
+class TransferError(Exception):
+    pass
+
+
+class Link:
+    """A raw connection to the watch's shell."""
+
+    def __init__(self, port):
+        self.fd = os.open(port, os.O_RDWR | os.O_NOCTTY)
+        if os.isatty(self.fd):
+            self.saved_attributes = termios.tcgetattr(self.fd)
+            tty.setraw(self.fd)
+        else:
+            self.saved_attributes = None
+        self.pending = b''
+
+    def close(self):
+        if self.saved_attributes is not None:
+            termios.tcsetattr(self.fd, termios.TCSADRAIN, self.saved_attributes)
+        os.close(self.fd)
+
+    def write(self, data):
+        while data:
+            data = data[os.write(self.fd, data):]
+
+    def read_some(self, timeout):
+        """Returns whatever arrives in the next timeout seconds, or b'' if nothing does."""
+        if self.pending:
+            data, self.pending = self.pending, b''
+            return data
+        readable, _, _ = select.select([self.fd], [], [], timeout)
+        return os.read(self.fd, 4096) if readable else b''
+
+    def command(self, line):
+        # anything left over from before (a prompt, an old transfer) isn't ours.
+        while self.read_some(0.1):
+            pass
+        self.write(line.encode() + b'\r')
+
+    def send_frame(self, frame_type, offset, payload=b''):
+        self.write(encode_frame(frame_type, offset, payload))
+
+    def read_frame(self, timeout=TIMEOUT):
+        """Returns the next frame as (type, offset, payload). Anything that isn't a frame with a good CRC is
+        skipped: the shell's echo and prompt run into the frames on either side of them, and look just like
+        a damaged frame. A frame that really was damaged shows up as a gap in the offsets, or a timeout."""
+        body = bytearray()
+        escaped = False
+        deadline = time.monotonic() + timeout
+        while True:
+            data = self.read_some(max(0, deadline - time.monotonic()))
+            if not data:
+                raise TransferError('the watch stopped answering')
+            for i, byte in enumerate(data):
+                if byte == SLIP_END:
+                    if len(body) < 7:
+                        body = bytearray()
+                        continue
+                    if crc16(body[:-2]) != struct.unpack('<H', body[-2:])[0]:
+                        body = bytearray()
+                        continue
+                    self.pending = data[i + 1:]
+                    frame_type, offset = struct.unpack('<BI', body[:5])
+                    return frame_type, offset, bytes(body[5:-2])
+                if byte == SLIP_ESC:
+                    escaped = True
+                    continue
+                if escaped:
+                    byte = {SLIP_ESC_END: SLIP_END, SLIP_ESC_ESC: SLIP_ESC}.get(byte, byte)
+                    escaped = False
+                body.append(byte)
+            deadline = time.monotonic() + timeout
+
+
+def check_error(frame_type, payload):
+    if frame_type == ERROR:
+        raise TransferError('the watch says: ' + payload.decode(errors='replace'))
+
+
+def progress(done, total):
+    if total:
+        sys.stderr.write('\r%d of %d bytes (%d%%)' % (done, total, done * 100 // total))
+        sys.stderr.flush()
+
+
+def put(link, local, remote, resume):
+    with open(local, 'rb') as f:
+        data = f.read()
+    started = time.monotonic()
+
+    link.command('put %s %d' % (remote, 1 if resume else 0))
+    frame_type, offset, payload = link.read_frame()
+    check_error(frame_type, payload)
+    if frame_type != ACK or offset > len(data):
+        raise TransferError("the watch's copy doesn't match this file")
+
+    retries = 0
+    while offset < len(data):
+        link.send_frame(DATA, offset, data[offset:offset + CHUNK_SIZE])
+        try:
+            frame_type, new_offset, payload = link.read_frame()
+        except TransferError:
+            # our frame or its ack got lost; send it again, and the watch will nak it if it already has it.
+            frame_type = None
+        check_error(frame_type, payload)
+        if frame_type == ACK:
+            offset = new_offset
+            retries = 0
+            progress(offset, len(data))
+            continue
+        retries += 1
+        if retries > RETRIES:
+            raise TransferError('too many retries at offset %d' % offset)
+        if frame_type == NAK:
+            offset = new_offset
+
+    link.send_frame(END, offset)
+    frame_type, offset, payload = link.read_frame()
+    check_error(frame_type, payload)
+    if frame_type != ACK or offset != len(data):
+        raise TransferError('the watch did not confirm the file')
+    return len(data), time.monotonic() - started
+
+
+def receive(link, command, offset, write):
+    """Runs a command that streams data frames, like get or dump, and passes each payload to write, starting
+    from offset. If a frame goes missing, runs the command again from the last good one."""
+    for attempt in range(RETRIES + 1):
+        link.command('%s %d' % (command, offset))
+        while True:
+            frame_type, frame_offset, payload = link.read_frame()
+            check_error(frame_type, payload)
+            if frame_offset != offset:
+                # damaged or missing data: let this run out, then start again from what we have.
+                break
+            if frame_type == END:
+                return offset
+            write(payload)
+            offset += len(payload)
+            sys.stderr.write('\r%d bytes' % offset)
+            sys.stderr.flush()
+        while link.read_some(0.5):
+            pass
+    raise TransferError('too many retries at offset %d' % offset)
+
+
+def get(link, remote, local, resume):
+    offset = os.path.getsize(local) if resume and os.path.exists(local) else 0
+    started = time.monotonic()
+
+    with open(local, 'ab' if offset else 'wb') as f:
+        size = receive(link, 'get ' + remote, offset, f.write)
+    return size - offset, time.monotonic() - started
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Copy files to and from the watch over the USB shell.')
+    parser.add_argument('port', help='serial port, i.e. /dev/ttyACM0')
+    parser.add_argument('direction', choices=['put', 'get'])
+    parser.add_argument('source')
+    parser.add_argument('destination')
+    parser.add_argument('--resume', action='store_true', help='carry on from an interrupted transfer')
+    args = parser.parse_args()
+
+    link = Link(args.port)
+    try:
+        if args.direction == 'put':
+            size, elapsed = put(link, args.source, args.destination, args.resume)
+        else:
+            size, elapsed = get(link, args.source, args.destination, args.resume)
+    except TransferError as e:
+        sys.stderr.write('\n%s\n' % e)
+        return 1
+    finally:
+        link.close()
+    sys.stderr.write('\n%d bytes in %.1f seconds\n' % (size, elapsed))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,246 @@
+#!/usr/bin/env python3
+"""Converts buzzer tunes written as text into the compressed format watch_buzzer_play_tune plays.
+
+    tune_converter.py SOURCE -o OUTPUT.c [--export NAME ...] [--select NAME ...]
+
+The build runs this on movement/movement_custom_signal_tunes.txt. Each tune in SOURCE starts on a line of its own
+with its name and a colon, and its notes follow on the same line and any indented lines after it:
+
+    birthday: C6/6 -/2 C6/6 D6/13 C6/13 F6/13
+        E6/27
+
+A note is a pitch (C6, F#5, Bb4) or a rest (-), a slash, and a duration in 64ths of a second, less one; this is the
+same note and duration the int8_t sequences for watch_buzzer_play_sequence have. A tune can also be a line of
+RTTTL, the ringtone format, which is converted to the same thing:
+
+    tetris:d=4,o=5,b=160:e6,8b,8c6,8d6,16e6,16d6,8c6,8b,a,8a,8c6,e6
+
+Blank lines and lines starting with # are skipped. Tunes named with --export get a const uint8_t array of their
+own; the rest go in signal_tunes[], in the order they're in SOURCE, or just the ones named with --select. The
+output is only rewritten when it changes, so the build can run this every time without recompiling anything.
+
+The compressed format is described with watch_buzzer_play_tune in watch-library/shared/watch/watch_buzzer.h.
+"""
+import argparse
+import collections
+import os
+import re
+import sys
+
+NOTE_NAMES = {'C': 0, 'D': 2, 'E': 4, 'F': 5, 'G': 7, 'A': 9, 'B': 11}
+# the BuzzerNote enum starts at A1, and ends with B8 and then BUZZER_NOTE_REST.
+NOTE_A1 = 9 + 12
+NUM_NOTES = 87
+REST = NUM_NOTES
+# the pitch before the first note, for working out its delta.
+START_PITCH = 36    # BUZZER_NOTE_A4
+
+TICKS_PER_SECOND = 64
+# a duration lasts one tick more than its value, and the sequencer counts them out in 16 bits at 8 per tick.
+MAX_DURATION = 8190
+
+DURATION_TABLE_SIZE = 7
+PITCH_REST = 0
+PITCH_ABSOLUTE = 31
+PITCH_DELTA_BIAS = 16
+
+
+class TuneError(Exception):
+    pass
+
+
+def parse_pitch(text):
+    match = re.fullmatch(r'([A-Ga-g])([#b]?)(\d)', text)
+    if not match:
+        raise TuneError('bad note ' + text)
+    name, accidental, octave = match.groups()
+    note = int(octave) * 12 + NOTE_NAMES[name.upper()] - NOTE_A1 + {'#': 1, 'b': -1, '': 0}[accidental]
+    if not 0 <= note < NUM_NOTES:
+        raise TuneError(text + " is out of the buzzer's range (A1 to B8)")
+    return note
+
+
+def parse_notes(text):
+    notes = []
+    for token in text.split():
+        pitch, _, duration = token.partition('/')
+        if not duration.isdigit():
+            raise TuneError('bad note ' + token)
+        notes.append((REST if pitch == '-' else parse_pitch(pitch), int(duration)))
+    return notes
+
+
+def parse_rtttl(defaults, text):
+    settings = {'d': 4, 'o': 6, 'b': 63}
+    for setting in defaults.split(','):
+        key, _, value = setting.strip().partition('=')
+        if key not in settings or not value.isdigit():
+            raise TuneError('bad RTTTL setting ' + setting)
+        settings[key] = int(value)
+    # a whole note is four beats.
+    whole = 4 * 60 * TICKS_PER_SECOND / settings['b']
+    notes = []
+    for token in text.replace(' ', '').split(','):
+        match = re.fullmatch(r'(\d*)([a-hp])(#?)(\.?)(\d?)(\.?)', token.lower())
+        if not match:
+            raise TuneError('bad RTTTL note ' + token)
+        divider, name, sharp, dot1, octave, dot2 = match.groups()
+        ticks = whole / int(divider or settings['d'])
+        if dot1 or dot2:
+            ticks *= 1.5
+        duration = max(1, round(ticks) - 1)
+        if name == 'p':
+            notes.append((REST, duration))
+        else:
+            name = 'B' if name == 'h' else name.upper()
+            notes.append((parse_pitch(name + sharp + (octave or str(settings['o']))), duration))
+    return notes
+
+
+def parse(lines):
+    """Returns the tunes in lines as an ordered dict of name to a list of (note, duration)."""
+    tunes = collections.OrderedDict()
+    name = None
+    for number, line in enumerate(lines, 1):
+        try:
+            if not line.strip() or line.startswith('#'):
+                continue
+            if line[0].isspace():
+                if name is None:
+                    raise TuneError('notes before the first tune')
+                tunes[name].extend(parse_notes(line))
+                continue
+            name, _, rest = line.partition(':')
+            name = name.strip()
+            if not re.fullmatch(r'[A-Za-z_][A-Za-z0-9_]*', name):
+                raise TuneError('a tune needs a name that works in C, not ' + name)
+            if name in tunes:
+                raise TuneError('there are two tunes called ' + name)
+            defaults, colon, notes = rest.partition(':')
+            tunes[name] = parse_rtttl(defaults, notes) if colon else parse_notes(rest)
+        except TuneError as e:
+            raise TuneError('line %d: %s' % (number, e))
+    return tunes
+
+
+def varint(value):
+    encoded = bytearray()
+    while value >= 0x80:
+        encoded.append(0x80 | (value & 0x7F))
+        value >>= 7
+    encoded.append(value)
+    return encoded
+
+
+def compress(name, notes):
+    # run-length rests: back to back rests are one long rest, which lasts as long as all of them did.
+    merged = []
+    for note, duration in notes:
+        if duration < 1:
+            raise TuneError('%s: a duration of zero would end the tune' % name)
+        if note == REST and merged and merged[-1][0] == REST:
+            merged[-1] = (REST, merged[-1][1] + duration + 1)
+        else:
+            merged.append((note, duration))
+    for note, duration in merged:
+        if duration > MAX_DURATION:
+            raise TuneError('%s: %d is longer than the buzzer can play in one note' % (name, duration))
+
+    # a table entry costs a byte once, and saves the byte after every note that uses it.
+    counts = collections.Counter(duration for _, duration in merged if duration <= 0xFF)
+    table = [duration for duration, count in counts.most_common(DURATION_TABLE_SIZE) if count > 1]
+
+    encoded = bytearray([len(table)]) + bytes(table)
+    pitch = START_PITCH
+    for note, duration in merged:
+        extra = bytearray()
+        if note == REST:
+            field = PITCH_REST
+        elif -PITCH_DELTA_BIAS < note - pitch < PITCH_ABSOLUTE - PITCH_DELTA_BIAS:
+            field = note - pitch + PITCH_DELTA_BIAS
+        else:
+            field = PITCH_ABSOLUTE
+            extra.append(note)
+        if duration in table:
+            code = table.index(duration) + 1
+        else:
+            code = 0
+            extra += varint(duration)
+            # a zero head byte ends the tune, so a rest with its own duration spells itself out.
+            if field == PITCH_REST:
+                field = PITCH_ABSOLUTE
+                extra[0:0] = bytes([REST])
+        encoded.append(field << 3 | code)
+        encoded += extra
+        if note != REST:
+            pitch = note
+    encoded.append(0)
+    return encoded
+
+
+def c_array(declaration, data):
+    lines = [declaration + ' = {']
+    for start in range(0, len(data), 16):
+        lines.append('    ' + ' '.join('0x%02x,' % byte for byte in data[start:start + 16]))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Convert buzzer tunes from text to C.')
+    parser.add_argument('source', help='text file of tunes')
+    parser.add_argument('-o', dest='output', required=True, help='C file to write')
+    parser.add_argument('--export', action='append', default=[], metavar='NAME',
+                        help='give this tune an array of its own, instead of putting it in signal_tunes[]')
+    parser.add_argument('--select', action='append', default=[], metavar='NAME',
+                        help='only put these tunes in signal_tunes[] (default: all of them)')
+    args = parser.parse_args()
+
+    try:
+        with open(args.source) as f:
+            tunes = parse(f.read().splitlines())
+        for name in args.export + args.select:
+            if name not in tunes:
+                raise TuneError('there is no tune called ' + name)
+        listed = [name for name in (args.select or tunes) if name not in args.export]
+        if not listed:
+            raise TuneError('signal_tunes[] needs at least one tune')
+        compressed = {name: compress(name, tunes[name]) for name in args.export + listed}
+    except TuneError as e:
+        sys.stderr.write('%s: %s\n' % (args.source, e))
+        return 1
+
+    output = ['// Generated by utils/tune_converter.py from %s; edit that instead.' % os.path.basename(args.source),
+              '',
+              '#include <stddef.h>',
+              '#include <stdint.h>',
+              '#include "movement_custom_signal_tunes.h"',
+              '']
+    for name in args.export:
+        output += ['// %d notes' % len(tunes[name]), c_array('const uint8_t %s[]' % name, compressed[name]), '']
+    for name in listed:
+        output += ['// %d notes' % len(tunes[name]), c_array('static const uint8_t %s[]' % name, compressed[name]),
+                   '']
+    output.append('const uint8_t *const signal_tunes[] = {')
+    output += ['    %s,' % name for name in listed]
+    output += ['};', '',
+               'const size_t NUM_TUNES = sizeof(signal_tunes) / sizeof(signal_tunes[0]);', '']
+    text = '\n'.join(output)
+
+    try:
+        with open(args.output) as f:
+            if f.read() == text:
+                return 0
+    except FileNotFoundError:
+        pass
+    with open(args.output, 'w') as f:
+        f.write(text)
+
+    pairs = sum(2 * len(tunes[name]) + 1 for name in compressed)
+    packed = sum(len(data) for data in compressed.values())
+    sys.stderr.write('%d tunes in %d bytes (%d as note and duration pairs)\n' % (len(compressed), packed, pairs))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
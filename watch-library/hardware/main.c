@@ -32,8 +32,26 @@
 #include "hal_init.h"
 #include "watch.h"
 #include "tusb.h"
+#include "watch_private_cdc.h"
+
+static watch_boot_times_t boot_times;
+
+const watch_boot_times_t *watch_get_boot_times(void) {
+    return &boot_times;
+}
+
+static uint32_t _boot_stage_time(uint32_t start) {
+    // the timer reads 0 once it has stopped, which the LED driver can make happen early.
+    uint32_t now = watch_get_boot_timer_us();
+    return now > start ? now - start : 0;
+}
 
 int main(void) {
+    uint32_t stage_start;
+
+    // time each stage of boot, so that we can tell where the time goes.
+    _watch_enable_boot_timer();
+
     // ASF code. Initialize the MCU with configuration options from Atmel Studio.
     init_mcu();
 
@@ -48,9 +66,13 @@ int main(void) {
 
     // initialize the delay driver before any user code is called.
     delay_driver_init();
+    boot_times.init_mcu = watch_get_boot_timer_us();
 
     // User code. Give the app a chance to initialize its data structures and state.
+    stage_start = watch_get_boot_timer_us();
     app_init();
+    boot_times.app_init = _boot_stage_time(stage_start);
+    stage_start = watch_get_boot_timer_us();
 
     // If the RTC is already enabled, we're either waking from BACKUP mode or a reset.
     // Ideally we should check if the TAMPER or CMP0 (alarm) flags are set.
@@ -107,17 +129,32 @@ int main(void) {
         #endif
         watch_rtc_set_date_time(date_time);
     }
+    boot_times.rtc = _boot_stage_time(stage_start);
 
     // User code. Give the app a chance to enable and set up peripherals.
+    stage_start = watch_get_boot_timer_us();
     app_setup();
+    boot_times.app_setup = _boot_stage_time(stage_start);
+
+    // boot is over; give the timer back.
+    _watch_disable_boot_timer();
 
     while (1) {
         bool usb_enabled = hri_usbdevice_get_CTRLA_ENABLE_bit(USB);
+        // the USB stack runs from its interrupt; anything it has for us (or we have for it) gets moved here.
+        if (usb_enabled) cdc_task();
         bool can_sleep = app_loop();
         if (can_sleep && !usb_enabled) {
             app_prepare_for_standby();
             sleep(4);
             app_wake_from_standby();
+        } else if (can_sleep) {
+            // USB needs its clocks, so no standby, but there's no need to spin either: IDLE until the USB stack,
+            // the RTC or a button has something for us. interrupts stay masked between the check and the WFI, so
+            // data that arrives in between still wakes us.
+            __disable_irq();
+            if (!cdc_task_pending()) sleep(2);
+            __enable_irq();
         }
     }
 
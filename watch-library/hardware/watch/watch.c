@@ -46,6 +46,72 @@ bool watch_is_usb_enabled(void) {
     return USB->DEVICE.CTRLA.bit.ENABLE;
 }
 
+void watch_set_cpu_speed(watch_cpu_speed_t speed) {
+    // USB was set up for the 8 MHz clock that _watch_enable_usb selected.
+    if (watch_is_usb_enabled()) return;
+
+    uint8_t fsel;
+    switch (speed) {
+        case WATCH_CPU_SPEED_16_MHZ:
+            fsel = OSCCTRL_OSC16MCTRL_FSEL_16_Val;
+            break;
+        case WATCH_CPU_SPEED_8_MHZ:
+            fsel = OSCCTRL_OSC16MCTRL_FSEL_8_Val;
+            break;
+        default:
+            fsel = OSCCTRL_OSC16MCTRL_FSEL_4_Val;
+            break;
+    }
+    if (hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL) == fsel) return;
+
+    // the flash needs a wait state to keep up with a 16 MHz CPU.
+    if (fsel == OSCCTRL_OSC16MCTRL_FSEL_16_Val) hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 1);
+
+    // the TCC prescaler is enable-protected, so the buzzer and LED stop for the moment it takes to switch over.
+    bool tcc_enabled = watch_is_buzzer_or_led_enabled() && hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE);
+    if (tcc_enabled) {
+        hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
+        hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+    }
+
+    // the boot timer counts GCLK0 too, so it has to catch up at the old speed first.
+    watch_get_boot_timer_us();
+    hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, fsel);
+    while (!hri_oscctrl_get_STATUS_OSC16MRDY_bit(OSCCTRL));
+
+    if (tcc_enabled) {
+        hri_tcc_write_CTRLA_PRESCALER_bf(TCC0, _watch_get_tcc_prescaler());
+        hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
+        hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+    }
+
+    if (fsel != OSCCTRL_OSC16MCTRL_FSEL_16_Val) hri_nvmctrl_write_CTRLB_RWS_bf(NVMCTRL, 0);
+}
+
+watch_cpu_speed_t watch_get_cpu_speed(void) {
+    switch (hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL)) {
+        case OSCCTRL_OSC16MCTRL_FSEL_16_Val:
+            return WATCH_CPU_SPEED_16_MHZ;
+        case OSCCTRL_OSC16MCTRL_FSEL_8_Val:
+            return WATCH_CPU_SPEED_8_MHZ;
+        default:
+            return WATCH_CPU_SPEED_4_MHZ;
+    }
+}
+
+void watch_cycle_timer_start(void) {
+    // the delay driver reprograms SysTick on every call, so there's nothing to preserve here.
+    SysTick->LOAD = 0xFFFFFF;
+    SysTick->VAL = 0;
+    SysTick->CTRL = SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_CLKSOURCE_Msk;
+}
+
+uint32_t watch_cycle_timer_get_us(void) {
+    uint32_t cycles = 0xFFFFFF - SysTick->VAL;
+    // the main clock runs at (FSEL + 1) * 4 MHz.
+    return cycles / ((hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL) + 1) * 4);
+}
+
 void watch_reset_to_bootloader(void) {
     volatile uint32_t *dbl_tap_ptr = ((volatile uint32_t *)(HSRAM_ADDR + HSRAM_SIZE - 4));
     *dbl_tap_ptr = 0xf01669ef; // from the UF2 bootloaer: uf2.h line 255
@@ -27,121 +27,306 @@
 #include "../../../watch-library/hardware/include/saml22j18a.h"
 #include "../../../watch-library/hardware/include/component/tc.h"
 #include "../../../watch-library/hardware/hri/hri_tc_l22.h"
+#include "watch_private.h"
 
-void cb_watch_buzzer_seq(void);
+// Sequences play without the CPU. TC3 counts out each note, and its overflow event goes through the event system to
+// three DMA channels, which load the next note's period and duty cycle into TCC0 and its duration into TC3. The CPU
+// expands the sequence (with its repeats) a chunk of notes at a time, and only wakes up when a chunk is used up.
+#define WATCH_BUZZER_SEQUENCE_CHUNK 16
+
+// TC3 counts at 512 Hz; sequence durations are in 64ths of a second, and a note lasts one more than its duration.
+#define WATCH_BUZZER_SEQUENCE_TICK 8
+
+static uint32_t _seq_periods[WATCH_BUZZER_SEQUENCE_CHUNK];
+static uint32_t _seq_duties[WATCH_BUZZER_SEQUENCE_CHUNK];
+static uint16_t _seq_durations[WATCH_BUZZER_SEQUENCE_CHUNK];
+
+typedef struct {
+    uint32_t period;
+    uint32_t duty;
+    uint16_t duration;
+} watch_buzzer_step_t;
 
 static uint16_t _seq_position;
-static int8_t _tone_ticks, _repeat_counter;
-static bool _callback_running = false;
+static int8_t _repeat_counter;
+static bool _sequence_running = false;
+// the note/duration sequence being played, or NULL when it's a compressed tune or notes.
 static int8_t *_sequence;
+static watch_buzzer_tune_reader_t _tune;
+// the notes being played, and how many are left, or NULL.
+static const watch_buzzer_note_t *_notes;
+static uint8_t _notes_left;
+// watch_buzzer_play_note_async's note, which the caller doesn't have to keep.
+static watch_buzzer_note_t _single_note;
 static void (*_cb_finished)(void);
+// the next step that hasn't gone into the DMA buffers; TC3 needs its duration one step early.
+static watch_buzzer_step_t _lookahead;
+// set once _lookahead is the tick of silence after the last note.
+static bool _seq_ended;
+// set once the DMA buffers hold that silence, so the current chunk is the last one.
+static bool _seq_final_chunk;
 
-static void _tcc_write_RUNSTDBY(bool value) {
-    // enables or disables RUNSTDBY of the tcc
-    hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
-    hri_tcc_write_CTRLA_RUNSTDBY_bit(TCC0, value);
-    hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
-    hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
-}
-
-static inline void _tc3_start() {
-    // start the TC3 timer
-    hri_tc_set_CTRLA_ENABLE_bit(TC3);
-    _callback_running = true;
+static void _tc3_initialize(void) {
+    // TC3 counts at 512 Hz, and overflows at the end of each note: CC0 holds the current note's length, and CCBUF0
+    // the next one's, which TC3 loads itself when it overflows.
+    hri_mclk_set_APBCMASK_TC3_bit(MCLK);
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC3_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+    hri_tc_clear_CTRLA_ENABLE_bit(TC3);
+    hri_tc_wait_for_sync(TC3, TC_SYNCBUSY_ENABLE);
+    hri_tc_write_CTRLA_reg(TC3, TC_CTRLA_SWRST);
+    hri_tc_wait_for_sync(TC3, TC_SYNCBUSY_SWRST);
+    hri_tc_write_CTRLA_reg(TC3, TC_CTRLA_PRESCALER_DIV64 |  // 32 KHz divided by 64 equals 512 Hz
+                           TC_CTRLA_MODE_COUNT16 |
+                           TC_CTRLA_RUNSTDBY);
+    hri_tc_write_WAVE_reg(TC3, TC_WAVE_WAVEGEN_MFRQ);
+    hri_tc_write_EVCTRL_reg(TC3, TC_EVCTRL_OVFEO);
 }
 
-static inline void _tc3_stop() {
-    // stop the TC3 timer
+static void _tc3_stop(void) {
     hri_tc_clear_CTRLA_ENABLE_bit(TC3);
     hri_tc_wait_for_sync(TC3, TC_SYNCBUSY_ENABLE);
-    _callback_running = false;
 }
 
-static void _tc3_initialize() {
-    // setup and initialize TC3 for a 64 Hz interrupt
-    hri_mclk_set_APBCMASK_TC3_bit(MCLK);
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC3_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+static void _evsys_initialize(void) {
+    // the event channel is resynchronized to GCLK3, which TC3 runs from too, and keeps going in standby.
+    hri_mclk_set_APBCMASK_EVSYS_bit(MCLK);
+    hri_gclk_write_PCHCTRL_reg(GCLK, EVSYS_GCLK_ID_0 + WATCH_EVSYS_CHANNEL_BUZZER, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+    EVSYS->CHANNEL[WATCH_EVSYS_CHANNEL_BUZZER].reg = EVSYS_CHANNEL_EVGEN(EVSYS_ID_GEN_TC3_OVF) |
+                                                     EVSYS_CHANNEL_PATH_RESYNCHRONIZED |
+                                                     EVSYS_CHANNEL_EDGSEL_RISING_EDGE |
+                                                     EVSYS_CHANNEL_RUNSTDBY;
+    // a user's CHANNEL field is the event channel number plus one; zero means no channel.
+    EVSYS->USER[EVSYS_ID_USER_DMAC_CH_0 + WATCH_DMA_CHANNEL_BUZZER_PERIOD].reg = EVSYS_USER_CHANNEL(WATCH_EVSYS_CHANNEL_BUZZER + 1);
+    EVSYS->USER[EVSYS_ID_USER_DMAC_CH_0 + WATCH_DMA_CHANNEL_BUZZER_DUTY].reg = EVSYS_USER_CHANNEL(WATCH_EVSYS_CHANNEL_BUZZER + 1);
+    EVSYS->USER[EVSYS_ID_USER_DMAC_CH_0 + WATCH_DMA_CHANNEL_BUZZER_DURATION].reg = EVSYS_USER_CHANNEL(WATCH_EVSYS_CHANNEL_BUZZER + 1);
+}
+
+/// @brief Reads the next note from the sequence, following any repeat marker.
+/// @return false at the end of the sequence.
+static bool _seq_next_sequence_note(BuzzerNote *note, uint16_t *ticks) {
+    if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
+        // repeat indicator found
+        if (_repeat_counter == -1) {
+            // first encounter: load repeat counter
+            _repeat_counter = _sequence[_seq_position + 1];
+        } else _repeat_counter--;
+        if (_repeat_counter > 0)
+            // rewind
+            if (_seq_position > _sequence[_seq_position] * -2)
+                _seq_position += _sequence[_seq_position] * 2;
+            else
+                _seq_position = 0;
+        else {
+            // continue
+            _seq_position += 2;
+            _repeat_counter = -1;
+        }
+    }
+    if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
+        *note = _sequence[_seq_position];
+        *ticks = _sequence[_seq_position + 1];
+        _seq_position += 2;
+        return true;
+    }
+    return false;
+}
+
+/// @brief Reads the next note from whatever is playing, with its length in TC3 counts less one.
+/// @return false at the end.
+static bool _seq_next_note(BuzzerNote *note, uint16_t *duration) {
+    uint16_t ticks;
+    if (_notes) {
+        if (!_notes_left) return false;
+        *note = _notes->note;
+        // 512 counts a second, rounded to the nearest count; a note is at least one.
+        uint32_t counts = ((uint32_t)_notes->duration_ms * 64 + 62) / 125;
+        *duration = counts ? (counts > 0xFFFF ? 0xFFFF : counts) - 1 : 0;
+        _notes++;
+        _notes_left--;
+        return true;
+    }
+    if (_sequence) {
+        if (!_seq_next_sequence_note(note, &ticks)) return false;
+    } else {
+        if (!_watch_buzzer_tune_next(&_tune, note, &ticks)) return false;
+    }
+    *duration = (ticks + 1) * WATCH_BUZZER_SEQUENCE_TICK - 1;
+    return true;
+}
+
+static void _seq_read_step(watch_buzzer_step_t *step) {
+    BuzzerNote note;
+    uint16_t duration;
+    if (_seq_ended || !_seq_next_note(&note, &duration)) {
+        // one tick of silence after the last note; the DMAC stops once it has loaded this.
+        _seq_ended = true;
+        step->duty = 0;
+        step->duration = WATCH_BUZZER_SEQUENCE_TICK - 1;
+        return;
+    }
+    // a rest keeps the last period, and turns the output off with a duty cycle of zero.
+    if (note != BUZZER_NOTE_REST) {
+        step->period = NotePeriods[note];
+        step->duty = step->period / 2;
+    } else {
+        step->duty = 0;
+    }
+    step->duration = duration;
+}
+
+static uint8_t _seq_fill_chunk(void) {
+    uint8_t count = 0;
+    while (count < WATCH_BUZZER_SEQUENCE_CHUNK && !_seq_final_chunk) {
+        _seq_final_chunk = _seq_ended;
+        _seq_periods[count] = _lookahead.period;
+        _seq_duties[count] = _lookahead.duty;
+        // each overflow loads a note into TCC0, and the length of the one after it into TC3's buffer.
+        _seq_read_step(&_lookahead);
+        _seq_durations[count] = _lookahead.duration;
+        count++;
+    }
+    return count;
+}
+
+static void _seq_start_channel(uint8_t channel, uint32_t beatsize, const void *source_end, volatile void *destination, uint8_t count) {
+    // the DMAC wants the address one past the end of a buffer it increments through.
+    DmacDescriptor *descriptor = _watch_dma_get_descriptor(channel);
+    descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID | beatsize | DMAC_BTCTRL_SRCINC;
+    descriptor->BTCNT.reg = count;
+    descriptor->SRCADDR.reg = (uint32_t)source_end;
+    descriptor->DSTADDR.reg = (uint32_t)destination;
+    descriptor->DESCADDR.reg = 0;
+
+    hri_dmac_write_CHID_reg(DMAC, channel);
+    hri_dmac_write_CHCTRLB_reg(DMAC, DMAC_CHCTRLB_TRIGSRC_DISABLE | DMAC_CHCTRLB_TRIGACT_BEAT |
+                                     DMAC_CHCTRLB_EVIE | DMAC_CHCTRLB_EVACT_TRIG);
+    // the channels go in number order on each event, so the last one finishing means the chunk is done.
+    if (channel == WATCH_DMA_CHANNEL_BUZZER_DURATION) hri_dmac_set_CHINTEN_TCMPL_bit(DMAC);
+    hri_dmac_write_CHCTRLA_reg(DMAC, DMAC_CHCTRLA_ENABLE | DMAC_CHCTRLA_RUNSTDBY);
+}
+
+static void _seq_start_chunk(void) {
+    uint8_t count = _seq_fill_chunk();
+    _seq_start_channel(WATCH_DMA_CHANNEL_BUZZER_PERIOD, DMAC_BTCTRL_BEATSIZE_WORD, _seq_periods + count,
+                       &TCC0->PERBUF.reg, count);
+    _seq_start_channel(WATCH_DMA_CHANNEL_BUZZER_DUTY, DMAC_BTCTRL_BEATSIZE_WORD, _seq_duties + count,
+                       &TCC0->CCBUF[WATCH_BUZZER_TCC_CHANNEL].reg, count);
+    _seq_start_channel(WATCH_DMA_CHANNEL_BUZZER_DURATION, DMAC_BTCTRL_BEATSIZE_HWORD, _seq_durations + count,
+                       &TC3->COUNT16.CCBUF[0].reg, count);
+}
+
+static void _seq_stop(void) {
     _tc3_stop();
-    hri_tc_write_CTRLA_reg(TC3, TC_CTRLA_SWRST);
-    hri_tc_wait_for_sync(TC3, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC3, TC_CTRLA_PRESCALER_DIV64 |
-                           TC_CTRLA_MODE_COUNT8 | 
-                           TC_CTRLA_RUNSTDBY);
-    hri_tccount8_write_PER_reg(TC3, 7);   // 32 Khz divided by 64 divided by 8 equals 64 Hz
-    hri_tc_set_INTEN_OVF_bit(TC3);
-    NVIC_ClearPendingIRQ(TC3_IRQn);
-    NVIC_EnableIRQ (TC3_IRQn);
+    __disable_irq();
+    _watch_dma_stop_channel(WATCH_DMA_CHANNEL_BUZZER_PERIOD);
+    _watch_dma_stop_channel(WATCH_DMA_CHANNEL_BUZZER_DUTY);
+    _watch_dma_stop_channel(WATCH_DMA_CHANNEL_BUZZER_DURATION);
+    __enable_irq();
+    _watch_dma_set_callback(WATCH_DMA_CHANNEL_BUZZER_DURATION, NULL);
+    _sequence_running = false;
+}
+
+static void _seq_chunk_done(void) {
+    if (!_seq_final_chunk) {
+        // the next overflow is at least a 64th of a second away, which is plenty of time to set up the next chunk.
+        _seq_start_chunk();
+        return;
+    }
+    // the tick of silence has just started; the sequence is over.
+    watch_buzzer_abort_sequence();
+    if (_cb_finished) _cb_finished();
+}
+
+static void _seq_play(void (*callback_on_end)(void)) {
+    _cb_finished = callback_on_end;
+    _seq_ended = false;
+    _seq_final_chunk = false;
+
+    // a rest before the first note leaves the period (and so the LED's brightness) as it was.
+    watch_buzzer_step_t first = { .period = NotePeriods[BUZZER_NOTE_A4] };
+    if (hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) first.period = hri_tcc_read_PER_reg(TCC0);
+    _seq_read_step(&first);
+    if (_seq_ended) {
+        // nothing to play.
+        if (_cb_finished) _cb_finished();
+        return;
+    }
+    _lookahead = first;
+    _seq_read_step(&_lookahead);
+
+    // prepare buzzer, and load the first note ourselves.
+    watch_enable_buzzer();
+    hri_tcc_write_PERBUF_reg(TCC0, first.period);
+    hri_tcc_write_CCBUF_reg(TCC0, WATCH_BUZZER_TCC_CHANNEL, first.duty);
+    watch_set_buzzer_on();
+
+    _tc3_initialize();
+    hri_tccount16_write_CC_reg(TC3, 0, first.duration);
+    hri_tccount16_write_CCBUF_reg(TC3, 0, _lookahead.duration);
+    _evsys_initialize();
+    _watch_dma_set_callback(WATCH_DMA_CHANNEL_BUZZER_DURATION, _seq_chunk_done);
+    _seq_start_chunk();
+
+    // TCC should run in standby mode
+    _watch_tcc_run_in_standby(WATCH_TCC_STANDBY_BUZZER, true);
+    _sequence_running = true;
+    hri_tc_set_CTRLA_ENABLE_bit(TC3);
 }
 
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
-    if (_callback_running) _tc3_stop();
+    if (_sequence_running) _seq_stop();
     watch_set_buzzer_off();
     _sequence = note_sequence;
-    _cb_finished = callback_on_end;
+    _notes = NULL;
     _seq_position = 0;
-    _tone_ticks = 0;
     _repeat_counter = -1;
-    // prepare buzzer
-    watch_enable_buzzer();
-    // setup TC3 timer
-    _tc3_initialize();
-    // TCC should run in standby mode
-    _tcc_write_RUNSTDBY(true);
-    // start the timer (for the 64 hz callback)
-    _tc3_start();
-}
-
-void cb_watch_buzzer_seq(void) {
-    // callback for reading the note sequence
-    if (_tone_ticks == 0) {
-        if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
-            // repeat indicator found
-            if (_repeat_counter == -1) {
-                // first encounter: load repeat counter
-                _repeat_counter = _sequence[_seq_position + 1];
-            } else _repeat_counter--;
-            if (_repeat_counter > 0)
-                // rewind
-                if (_seq_position > _sequence[_seq_position] * -2)
-                    _seq_position += _sequence[_seq_position] * 2;
-                else
-                    _seq_position = 0;
-            else {
-                // continue
-                _seq_position += 2;
-                _repeat_counter = -1;
-            }
-        }
-        if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
-            // read note
-            BuzzerNote note = _sequence[_seq_position];
-            if (note != BUZZER_NOTE_REST) {
-                watch_set_buzzer_period(NotePeriods[note]);
-                watch_set_buzzer_on();
-            } else watch_set_buzzer_off();
-            // set duration ticks and move to next tone
-            _tone_ticks = _sequence[_seq_position + 1];
-            _seq_position += 2;
-        } else {
-            // end the sequence
-            watch_buzzer_abort_sequence();
-            if (_cb_finished) _cb_finished();
-        }
-    } else _tone_ticks--;
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void)) {
+    if (_sequence_running) _seq_stop();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _notes = NULL;
+    _watch_buzzer_tune_start(&_tune, tune);
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_notes(const watch_buzzer_note_t *notes, uint8_t count, void (*callback_on_end)(void)) {
+    if (_sequence_running) _seq_stop();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _notes = notes;
+    _notes_left = count;
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_note_async(BuzzerNote note, uint16_t duration_ms, void (*callback_on_end)(void)) {
+    _single_note.note = note;
+    _single_note.duration_ms = duration_ms;
+    watch_buzzer_play_notes(&_single_note, 1, callback_on_end);
 }
 
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
-    if (_callback_running) _tc3_stop();
+    if (_sequence_running) {
+        _seq_stop();
+        // a rest or the end of the sequence leaves the duty cycle at zero; put it back for watch_set_buzzer_on.
+        hri_tcc_write_CCBUF_reg(TCC0, WATCH_BUZZER_TCC_CHANNEL, hri_tcc_read_PERBUF_reg(TCC0) / 2);
+    }
     watch_set_buzzer_off();
-    // disable standby mode for TCC
-    _tcc_write_RUNSTDBY(false);
+    // disable standby mode for TCC, unless the LED still needs it
+    _watch_tcc_run_in_standby(WATCH_TCC_STANDBY_BUZZER, false);
 }
 
-void TC3_Handler(void) {
-    // interrupt handler vor TC3 (globally!)
-    cb_watch_buzzer_seq();
-    TC3->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
+void watch_buzzer_wait_for_sequence(void) {
+    // the DMA callback clears _sequence_running from its interrupt, which also wakes us; interrupts stay masked
+    // between the check and the WFI, so one that lands in between still wakes us.
+    while (_sequence_running) {
+        __disable_irq();
+        if (_sequence_running) sleep(hri_usbdevice_get_CTRLA_ENABLE_bit(USB) ? 2 : 4);
+        __enable_irq();
+    }
 }
 
 inline void watch_enable_buzzer(void) {
@@ -170,6 +355,12 @@ inline void watch_set_buzzer_off(void) {
 }
 
 void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
+    if (!_sequence_running) {
+        watch_buzzer_play_note_async(note, duration_ms, NULL);
+        watch_buzzer_wait_for_sequence();
+        return;
+    }
+    // don't cut off a sequence someone else is waiting on; play over it, the way this always has.
     if (note == BUZZER_NOTE_REST) {
         watch_set_buzzer_off();
     } else {
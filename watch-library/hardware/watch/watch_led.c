@@ -23,6 +23,137 @@
  */
 
 #include "watch_led.h"
+#include "../../../watch-library/hardware/include/saml22j18a.h"
+#include "../../../watch-library/hardware/include/component/tc.h"
+#include "../../../watch-library/hardware/hri/hri_tc_l22.h"
+#include "watch_private.h"
+
+// Fades and blinks run without the CPU. TC1 counts out each step, and its overflow triggers one DMA channel per LED,
+// which loads that LED's duty cycle for the step into TCC0. TC0 is the one-shot timer behind watch_led_set_timeout.
+// Both count at 512 Hz from GCLK3, which keeps going in standby.
+#define WATCH_LED_FADE_STEPS 64
+
+#ifdef WATCH_BLUE_TCC_CHANNEL
+#define WATCH_LED_CHANNELS 3
+static const uint8_t _led_tcc_channels[WATCH_LED_CHANNELS] = {WATCH_RED_TCC_CHANNEL, WATCH_GREEN_TCC_CHANNEL, WATCH_BLUE_TCC_CHANNEL};
+static const uint8_t _led_dma_channels[WATCH_LED_CHANNELS] = {WATCH_DMA_CHANNEL_LED_RED, WATCH_DMA_CHANNEL_LED_GREEN, WATCH_DMA_CHANNEL_LED_BLUE};
+#else
+#define WATCH_LED_CHANNELS 2
+static const uint8_t _led_tcc_channels[WATCH_LED_CHANNELS] = {WATCH_RED_TCC_CHANNEL, WATCH_GREEN_TCC_CHANNEL};
+static const uint8_t _led_dma_channels[WATCH_LED_CHANNELS] = {WATCH_DMA_CHANNEL_LED_RED, WATCH_DMA_CHANNEL_LED_GREEN};
+#endif
+
+// the duty cycles for each step, per LED. They fit in 16 bits, and a halfword write leaves CCBUF's top byte at zero.
+static uint16_t _led_steps[WATCH_LED_CHANNELS][WATCH_LED_FADE_STEPS];
+static bool _led_animating = false;
+static void (*_led_cb_finished)(void);
+static void (*_led_cb_timeout)(void);
+// TC0 is ours and counting down a timeout; during boot, the boot timer has it instead.
+static bool _led_timeout_running = false;
+
+static uint32_t _led_ms_to_counts(uint16_t ms) {
+    // 512 counts a second, rounded to the nearest count.
+    return ((uint32_t)ms * 64 + 62) / 125;
+}
+
+static void _led_timer_initialize(Tc *tc) {
+    // the boot timer borrows both of them until boot is over, so an LED effect during boot ends it early.
+    _watch_disable_boot_timer();
+    if (tc == TC0) hri_mclk_set_APBCMASK_TC0_bit(MCLK);
+    else hri_mclk_set_APBCMASK_TC1_bit(MCLK);
+    // TC0 and TC1 share a peripheral clock channel.
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK3 | GCLK_PCHCTRL_CHEN);
+    hri_tc_clear_CTRLA_ENABLE_bit(tc);
+    hri_tc_wait_for_sync(tc, TC_SYNCBUSY_ENABLE);
+    hri_tc_write_CTRLA_reg(tc, TC_CTRLA_SWRST);
+    hri_tc_wait_for_sync(tc, TC_SYNCBUSY_SWRST);
+    hri_tc_write_CTRLA_reg(tc, TC_CTRLA_PRESCALER_DIV64 |  // 32 KHz divided by 64 equals 512 Hz
+                           TC_CTRLA_MODE_COUNT16 |
+                           TC_CTRLA_RUNSTDBY);
+    // overflows when it gets to CC0, and starts over.
+    hri_tc_write_WAVE_reg(tc, TC_WAVE_WAVEGEN_MFRQ);
+}
+
+static void _led_timer_stop(Tc *tc) {
+    hri_tc_clear_CTRLA_ENABLE_bit(tc);
+    hri_tc_wait_for_sync(tc, TC_SYNCBUSY_ENABLE);
+    if (tc == TC0) hri_mclk_clear_APBCMASK_TC0_bit(MCLK);
+    else hri_mclk_clear_APBCMASK_TC1_bit(MCLK);
+    if (!hri_mclk_get_APBCMASK_TC0_bit(MCLK) && !hri_mclk_get_APBCMASK_TC1_bit(MCLK))
+        hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, 0);
+}
+
+static void _led_update_standby(void) {
+    // a lit LED needs the TCC in standby; an LED that's off looks the same either way.
+    bool lit = _led_animating;
+    for (uint8_t i = 0; i < WATCH_LED_CHANNELS; i++)
+        if (hri_tcc_read_CCBUF_reg(TCC0, _led_tcc_channels[i])) lit = true;
+    _watch_tcc_run_in_standby(WATCH_TCC_STANDBY_LED, lit);
+}
+
+static void _led_stop_animation(void) {
+    if (!_led_animating) return;
+    _led_timer_stop(TC1);
+    __disable_irq();
+    for (uint8_t i = 0; i < WATCH_LED_CHANNELS; i++) _watch_dma_stop_channel(_led_dma_channels[i]);
+    __enable_irq();
+    _watch_dma_set_callback(_led_dma_channels[WATCH_LED_CHANNELS - 1], NULL);
+    _led_animating = false;
+}
+
+static void _led_animation_done(void) {
+    void (*callback)(void) = _led_cb_finished;
+    _led_stop_animation();
+    _led_update_standby();
+    if (callback) callback();
+}
+
+static void _led_animate(uint8_t steps, uint32_t step_counts, bool repeat, void (*callback_on_end)(void)) {
+    _led_cb_finished = callback_on_end;
+    _led_timer_initialize(TC1);
+    hri_tccount16_write_CC_reg(TC1, 0, (step_counts > 0xFFFF ? 0xFFFF : step_counts) - 1);
+
+    for (uint8_t i = 0; i < WATCH_LED_CHANNELS; i++) {
+        uint8_t channel = _led_dma_channels[i];
+        // the DMAC wants the address one past the end of a buffer it increments through.
+        DmacDescriptor *descriptor = _watch_dma_get_descriptor(channel);
+        descriptor->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_HWORD | DMAC_BTCTRL_SRCINC;
+        descriptor->BTCNT.reg = steps;
+        descriptor->SRCADDR.reg = (uint32_t)(_led_steps[i] + steps);
+        descriptor->DSTADDR.reg = (uint32_t)&TCC0->CCBUF[_led_tcc_channels[i]].reg;
+        // a descriptor that links back to itself goes around until something stops it.
+        descriptor->DESCADDR.reg = repeat ? (uint32_t)descriptor : 0;
+
+        hri_dmac_write_CHID_reg(DMAC, channel);
+        hri_dmac_write_CHCTRLB_reg(DMAC, DMAC_CHCTRLB_TRIGSRC(TC1_DMAC_ID_OVF) | DMAC_CHCTRLB_TRIGACT_BEAT);
+        // the channels go in number order on each trigger, so the last one finishing means the fade is done.
+        if (!repeat && i == WATCH_LED_CHANNELS - 1) {
+            _watch_dma_set_callback(channel, _led_animation_done);
+            hri_dmac_set_CHINTEN_TCMPL_bit(DMAC);
+        }
+        hri_dmac_write_CHCTRLA_reg(DMAC, DMAC_CHCTRLA_ENABLE | DMAC_CHCTRLA_RUNSTDBY);
+    }
+
+    _led_animating = true;
+    _watch_tcc_run_in_standby(WATCH_TCC_STANDBY_LED, true);
+    hri_tc_set_CTRLA_ENABLE_bit(TC1);
+}
+
+static uint16_t _led_sqrt(uint32_t value) {
+    uint32_t root = 0;
+    uint32_t bit = 1ul << 30;
+    while (bit > value) bit >>= 2;
+    while (bit) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
 
 void watch_enable_leds(void) {
     if (!hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) {
@@ -31,6 +162,7 @@ void watch_enable_leds(void) {
 }
 
 void watch_disable_leds(void) {
+    _led_stop_animation();
     _watch_disable_tcc();
 }
 
@@ -46,6 +178,7 @@ void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
 #ifndef WATCH_BLUE_TCC_CHANNEL
     (void) blue; // silence warning
 #endif
+    _led_stop_animation();
     if (hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) {
         uint32_t period = hri_tcc_get_PER_reg(TCC0, TCC_PER_MASK);
         hri_tcc_write_CCBUF_reg(TCC0, WATCH_RED_TCC_CHANNEL, ((period * red * 1000ull) / 255000ull));
@@ -53,7 +186,89 @@ void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
 #ifdef WATCH_BLUE_TCC_CHANNEL
         hri_tcc_write_CCBUF_reg(TCC0, WATCH_BLUE_TCC_CHANNEL, ((period * blue * 1000ull) / 255000ull));
 #endif
+        _led_update_standby();
+    }
+}
+
+void watch_led_fade_to_color(uint8_t red, uint8_t green, uint16_t duration_ms, void (*callback_on_end)(void)) {
+#ifdef WATCH_BLUE_TCC_CHANNEL
+    watch_led_fade_to_color_rgb(red, green, 0, duration_ms, callback_on_end);
+#else
+    watch_led_fade_to_color_rgb(red, green, green, duration_ms, callback_on_end);
+#endif
+}
+
+void watch_led_fade_to_color_rgb(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, void (*callback_on_end)(void)) {
+    uint32_t counts = _led_ms_to_counts(duration_ms);
+    if (counts == 0 || !hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) {
+        watch_set_led_color_rgb(red, green, blue);
+        if (callback_on_end) callback_on_end();
+        return;
     }
+    _led_stop_animation();
+
+    const uint8_t target[3] = {red, green, blue};
+    uint8_t steps = counts < WATCH_LED_FADE_STEPS ? counts : WATCH_LED_FADE_STEPS;
+    uint32_t period = hri_tcc_get_PER_reg(TCC0, TCC_PER_MASK);
+    for (uint8_t i = 0; i < WATCH_LED_CHANNELS; i++) {
+        // step evenly through the square root of the duty cycle (in 8.8 fixed point), which the eye sees as an even
+        // fade; a straight line in duty cycle seems to rush through the dim end and crawl through the bright one.
+        int32_t from = _led_sqrt((hri_tcc_read_CCBUF_reg(TCC0, _led_tcc_channels[i]) << 16) / period);
+        uint32_t to_duty = (period * target[i] * 1000ull) / 255000ull;
+        int32_t to = _led_sqrt((to_duty << 16) / period);
+        for (uint8_t j = 1; j < steps; j++) {
+            uint32_t root = from + (to - from) * j / steps;
+            _led_steps[i][j - 1] = (period * root * root) >> 16;
+        }
+        // and end on exactly what watch_set_led_color would have set.
+        _led_steps[i][steps - 1] = to_duty;
+    }
+    _led_animate(steps, counts / steps, false, callback_on_end);
+}
+
+void watch_led_blink(uint8_t red, uint8_t green, uint16_t interval_ms) {
+    watch_set_led_color(red, green);
+    uint32_t counts = _led_ms_to_counts(interval_ms);
+    if (counts == 0 || !hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) return;
+    // the first step turns the LED off, and the second puts back the color we just set.
+    for (uint8_t i = 0; i < WATCH_LED_CHANNELS; i++) {
+        _led_steps[i][0] = 0;
+        _led_steps[i][1] = hri_tcc_read_CCBUF_reg(TCC0, _led_tcc_channels[i]);
+    }
+    _led_animate(2, counts, true, NULL);
+}
+
+void watch_led_set_timeout(uint16_t delay_ms, void (*callback)(void)) {
+    watch_led_clear_timeout();
+    uint32_t counts = _led_ms_to_counts(delay_ms);
+    _led_cb_timeout = callback;
+    _led_timer_initialize(TC0);
+    // stop after the first overflow, and wake us up for it.
+    hri_tc_set_CTRLB_ONESHOT_bit(TC0);
+    hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_CTRLB);
+    hri_tccount16_write_CC_reg(TC0, 0, counts ? counts - 1 : 0);
+    hri_tc_set_INTEN_OVF_bit(TC0);
+    NVIC_ClearPendingIRQ(TC0_IRQn);
+    NVIC_EnableIRQ(TC0_IRQn);
+    _led_timeout_running = true;
+    hri_tc_set_CTRLA_ENABLE_bit(TC0);
+}
+
+void watch_led_clear_timeout(void) {
+    _led_cb_timeout = NULL;
+    if (!_led_timeout_running) return;
+    _led_timeout_running = false;
+    NVIC_DisableIRQ(TC0_IRQn);
+    _led_timer_stop(TC0);
+    NVIC_ClearPendingIRQ(TC0_IRQn);
+}
+
+void TC0_Handler(void);
+void TC0_Handler(void) {
+    void (*callback)(void) = _led_cb_timeout;
+    hri_tc_clear_INTFLAG_OVF_bit(TC0);
+    watch_led_clear_timeout();
+    if (callback) callback();
 }
 
 void watch_set_led_red(void) {
@@ -134,8 +134,22 @@ void watch_disable_TRNG(void) {
 }
 
 
+uint8_t _watch_get_tcc_prescaler(void) {
+    switch (hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL)) {
+        case OSCCTRL_OSC16MCTRL_FSEL_16_Val:
+            return TCC_CTRLA_PRESCALER_DIV16_Val;
+        case OSCCTRL_OSC16MCTRL_FSEL_8_Val:
+            return TCC_CTRLA_PRESCALER_DIV8_Val;
+        default:
+            return TCC_CTRLA_PRESCALER_DIV4_Val;
+    }
+}
+
+// the buzzer and LED drivers that need TCC0 to run in standby; see _watch_tcc_run_in_standby.
+static uint8_t _tcc_standby_users;
+
 void _watch_enable_tcc(void) {
-    // clock TCC0 with the main clock (8 MHz) and enable the peripheral clock.
+    // clock TCC0 with the main clock (4, 8 or 16 MHz) and enable the peripheral clock.
     hri_gclk_write_PCHCTRL_reg(GCLK, TCC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
     hri_mclk_set_APBCMASK_TCC0_bit(MCLK);
     // disable and reset TCC0.
@@ -143,14 +157,10 @@ void _watch_enable_tcc(void) {
     hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
     hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_SWRST);
     hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_SWRST);
-    // divide the clock down to 1 MHz
-    if (hri_usbdevice_get_CTRLA_ENABLE_bit(USB)) {
-        // if USB is enabled, we are running an 8 MHz clock.
-        hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER_DIV8);
-    } else {
-        // otherwise it's 4 Mhz.
-        hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER_DIV4);
-    }
+    // divide the clock down to 1 MHz. The main clock is 4 MHz, unless USB is enabled (8 MHz) or someone has
+    // called watch_set_cpu_speed; watch_set_cpu_speed fixes this up if the speed changes while the TCC is running.
+    hri_tcc_write_CTRLA_reg(TCC0, TCC_CTRLA_PRESCALER(_watch_get_tcc_prescaler()) |
+                            (_tcc_standby_users ? TCC_CTRLA_RUNSTDBY : 0));
     // We're going to use normal PWM mode, which means period is controlled by PER, and duty cycle is controlled by
     // each compare channel's value:
     //  * Buzzer tones are set by setting PER to the desired period for a given frequency, and CC[1] to half of that
@@ -206,94 +216,136 @@ void _watch_disable_tcc(void) {
     // disable the TCC
     hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
     hri_mclk_clear_APBCMASK_TCC0_bit(MCLK);
-}    
+    _tcc_standby_users = 0;
+    hri_oscctrl_write_OSC16MCTRL_RUNSTDBY_bit(OSCCTRL, false);
+}
 
-void _watch_enable_tc0(void) {
-    // before we init TinyUSB, we are going to need a periodic callback to handle TinyUSB tasks.
-    // TC2 and TC3 are reserved for devices on the 9-pin connector, so let's use TC0.
-    // clock TC0 with the 8 MHz clock on GCLK0.
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
-    // and enable the peripheral clock.
+void _watch_tcc_run_in_standby(uint8_t user, bool run) {
+    // the buzzer calls this from the DMAC interrupt when a sequence ends, so keep it from landing in the middle.
+    __disable_irq();
+    uint8_t users = run ? (_tcc_standby_users | user) : (_tcc_standby_users & ~user);
+    if (users != _tcc_standby_users) {
+        _tcc_standby_users = users;
+        // TCC0 runs from GCLK0, and the OSC16M behind it stops in standby unless it's allowed to keep going. With
+        // ONDEMAND set, it only does so while a peripheral that runs in standby asks for it, which here is just TCC0.
+        hri_oscctrl_write_OSC16MCTRL_RUNSTDBY_bit(OSCCTRL, users != 0);
+        if (watch_is_buzzer_or_led_enabled() && hri_tcc_get_CTRLA_reg(TCC0, TCC_CTRLA_ENABLE)) {
+            // RUNSTDBY is enable-protected, so the outputs stop for a moment while it changes.
+            hri_tcc_clear_CTRLA_ENABLE_bit(TCC0);
+            hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+            hri_tcc_write_CTRLA_RUNSTDBY_bit(TCC0, users != 0);
+            hri_tcc_set_CTRLA_ENABLE_bit(TCC0);
+            hri_tcc_wait_for_sync(TCC0, TCC_SYNCBUSY_ENABLE);
+        }
+    }
+    __enable_irq();
+}
+
+static bool _boot_timer_running = false;
+static uint32_t _boot_timer_count;
+static uint32_t _boot_timer_us;
+
+void _watch_enable_boot_timer(void) {
+    // TC0 and TC1 belong to the LED driver, which doesn't need them until something asks for a fade or a timeout;
+    // faces are handed TC2, so stay off that one. Together they count to 32 bits, so no stage of boot can wrap them.
+    // clock them with GCLK0, the only clock running this early; it's 4 MHz out of reset, but USB and
+    // watch_set_cpu_speed change that, so we keep track as we go.
     hri_mclk_set_APBCMASK_TC0_bit(MCLK);
-    // disable and reset TC0.
-    hri_tc_clear_CTRLA_ENABLE_bit(TC0);
-    hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_ENABLE);
+    hri_mclk_set_APBCMASK_TC1_bit(MCLK);
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
     hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_SWRST);
     hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_PRESCALER_DIV1024 | // divide the 8 MHz clock by 1024 to count at 7812.5 Hz
-                                TC_CTRLA_MODE_COUNT8 |       // count in 8-bit mode
-                                TC_CTRLA_RUNSTDBY);          // run in standby, just in case we figure that out
-    hri_tccount8_write_PER_reg(TC0, 10);                     // 7812.5 Hz / 10 = 781.125 Hz
-    // set an interrupt on overflow; this will call TC0_Handler below.
-    hri_tc_set_INTEN_OVF_bit(TC0);
-
-    // set priority higher than TC1
-    NVIC_SetPriority(TC0_IRQn, 5);
-    NVIC_ClearPendingIRQ(TC0_IRQn);
-    NVIC_EnableIRQ(TC0_IRQn);
-
-    // Start the timer
+    hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_PRESCALER_DIV64 | // 4 MHz / 64 = 62500 Hz, or 16 µs per count
+                                TC_CTRLA_MODE_COUNT32);    // TC1 is the top half
     hri_tc_set_CTRLA_ENABLE_bit(TC0);
+    _boot_timer_count = 0;
+    _boot_timer_us = 0;
+    _boot_timer_running = true;
 }
 
-void _watch_disable_tc0(void) {
-    NVIC_DisableIRQ(TC0_IRQn);
-    NVIC_ClearPendingIRQ(TC0_IRQn);
+uint32_t watch_get_boot_timer_us(void) {
+    if (!_boot_timer_running) return 0;
+    // ask for the current count to be synchronized into the COUNT register before reading it.
+    hri_tc_set_CTRLB_CMD_bf(TC0, TC_CTRLBSET_CMD_READSYNC_Val);
+    hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_CTRLB);
+    uint32_t count = hri_tccount32_read_COUNT_reg(TC0);
+    // add up the counts since last time at the current clock speed: FSEL 0-3 is 4, 8, 12 or 16 MHz, so each
+    // count is 64 / (4 * (FSEL + 1)) µs. anything that changes FSEL while we run calls us first.
+    uint32_t mhz = 4 * (hri_oscctrl_read_OSC16MCTRL_FSEL_bf(OSCCTRL) + 1);
+    _boot_timer_us += (uint64_t)(count - _boot_timer_count) * 64 / mhz;
+    _boot_timer_count = count;
+    return _boot_timer_us;
+}
+
+void _watch_disable_boot_timer(void) {
+    if (!_boot_timer_running) return;
     hri_tc_clear_CTRLA_ENABLE_bit(TC0);
     hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_ENABLE);
     hri_tc_write_CTRLA_reg(TC0, TC_CTRLA_SWRST);
     hri_tc_wait_for_sync(TC0, TC_SYNCBUSY_SWRST);
-}
-
-void _watch_enable_tc1(void) {
-    hri_gclk_write_PCHCTRL_reg(GCLK, TC1_GCLK_ID, GCLK_PCHCTRL_GEN_GCLK0_Val | GCLK_PCHCTRL_CHEN);
-    // and enable the peripheral clock.
-    hri_mclk_set_APBCMASK_TC1_bit(MCLK);
-    // disable and reset TC1.
-    hri_tc_clear_CTRLA_ENABLE_bit(TC1);
-    hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_ENABLE);
     hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_SWRST);
     hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_SWRST);
-    hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_PRESCALER_DIV1024 | // divide the 8 MHz clock by 1024 to count at 7812.5 Hz
-                                TC_CTRLA_MODE_COUNT8 |       // count in 8-bit mode
-                                TC_CTRLA_RUNSTDBY);          // run in standby, just in case we figure that out
-    hri_tccount8_write_PER_reg(TC1, 20);                     // 7812.5 Hz / 50 = 156.25 Hz
-    // set an interrupt on overflow; this will call TC1_Handler below.
-    hri_tc_set_INTEN_OVF_bit(TC1);
-
-    // set priority lower than TC0
-    NVIC_SetPriority(TC1_IRQn, 6);
-    NVIC_ClearPendingIRQ(TC1_IRQn);
-    NVIC_EnableIRQ(TC1_IRQn);
-
-    // Start the timer
-    hri_tc_set_CTRLA_ENABLE_bit(TC1);
+    hri_gclk_write_PCHCTRL_reg(GCLK, TC0_GCLK_ID, 0);
+    hri_mclk_clear_APBCMASK_TC0_bit(MCLK);
+    hri_mclk_clear_APBCMASK_TC1_bit(MCLK);
+    _boot_timer_running = false;
 }
 
-void _watch_disable_tc1(void) {
-    NVIC_DisableIRQ(TC1_IRQn);
-    NVIC_ClearPendingIRQ(TC1_IRQn);
-    hri_tc_clear_CTRLA_ENABLE_bit(TC1);
-    hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_ENABLE);
-    hri_tc_write_CTRLA_reg(TC1, TC_CTRLA_SWRST);
-    hri_tc_wait_for_sync(TC1, TC_SYNCBUSY_SWRST);
+// the DMAC reads each channel's first descriptor from here, and writes back its progress to the other array.
+// both must be 16-byte aligned, and have an entry for every channel up to the highest one we use.
+static DmacDescriptor _dma_descriptors[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+static DmacDescriptor _dma_writeback[WATCH_DMA_NUM_CHANNELS] __attribute__((aligned(16)));
+static void (*_dma_callbacks[WATCH_DMA_NUM_CHANNELS])(void);
+
+DmacDescriptor *_watch_dma_get_descriptor(uint8_t channel) {
+    if (!hri_dmac_get_CTRL_DMAENABLE_bit(DMAC)) {
+        hri_mclk_set_AHBMASK_DMAC_bit(MCLK);
+        hri_dmac_write_CTRL_reg(DMAC, DMAC_CTRL_SWRST);
+        while (hri_dmac_get_CTRL_SWRST_bit(DMAC));
+        hri_dmac_write_BASEADDR_reg(DMAC, (uint32_t)_dma_descriptors);
+        hri_dmac_write_WRBADDR_reg(DMAC, (uint32_t)_dma_writeback);
+        hri_dmac_write_CTRL_reg(DMAC, DMAC_CTRL_DMAENABLE | DMAC_CTRL_LVLEN(0xF));
+        NVIC_ClearPendingIRQ(DMAC_IRQn);
+        NVIC_EnableIRQ(DMAC_IRQn);
+    }
+
+    return &_dma_descriptors[channel];
 }
 
-void TC0_Handler(void) {
-    tud_task();
-    TC0->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
+void _watch_dma_set_callback(uint8_t channel, void (*callback)(void)) {
+    _dma_callbacks[channel] = callback;
 }
 
-void TC1_Handler(void) {
-    cdc_task();
-    TC1->COUNT8.INTFLAG.reg |= TC_INTFLAG_OVF;
+void _watch_dma_stop_channel(uint8_t channel) {
+    hri_dmac_write_CHID_reg(DMAC, channel);
+    hri_dmac_clear_CHCTRLA_ENABLE_bit(DMAC);
+    while (hri_dmac_get_CHCTRLA_ENABLE_bit(DMAC));
+    hri_dmac_clear_CHINTFLAG_reg(DMAC, DMAC_CHINTFLAG_MASK);
+}
+
+void DMAC_Handler(void);
+void DMAC_Handler(void) {
+    // INTPEND always shows the lowest channel with a pending interrupt; clearing its flags moves on to the next.
+    // CHID selects the channel that the CH* registers refer to, so put it back for whatever we interrupted.
+    uint8_t chid = hri_dmac_read_CHID_reg(DMAC);
+    while (hri_dmac_get_INTSTATUS_reg(DMAC, (1 << WATCH_DMA_NUM_CHANNELS) - 1)) {
+        uint8_t channel = hri_dmac_read_INTPEND_ID_bf(DMAC);
+        hri_dmac_write_CHID_reg(DMAC, channel);
+        uint8_t flags = hri_dmac_read_CHINTFLAG_reg(DMAC);
+        hri_dmac_clear_CHINTFLAG_reg(DMAC, flags);
+        if ((flags & DMAC_CHINTFLAG_TCMPL) && channel < WATCH_DMA_NUM_CHANNELS && _dma_callbacks[channel] != NULL) {
+            _dma_callbacks[channel]();
+        }
+    }
+    hri_dmac_write_CHID_reg(DMAC, chid);
 }
 
 void _watch_enable_usb(void) {
     // disable USB, just in case.
     hri_usb_clear_CTRLA_ENABLE_bit(USB);
 
-    // bump clock up to 8 MHz
+    // bump clock up to 8 MHz, after the boot timer has counted up the time it spent at the old speed.
+    watch_get_boot_timer_us();
     hri_oscctrl_write_OSC16MCTRL_FSEL_bf(OSCCTRL, OSCCTRL_OSC16MCTRL_FSEL_8_Val);
 
     // reset flags and disable DFLL
@@ -333,15 +385,22 @@ void _watch_enable_usb(void) {
     gpio_set_pin_function(PIN_PA24, PINMUX_PA24G_USB_DM);
     gpio_set_pin_function(PIN_PA25, PINMUX_PA25G_USB_DP);
 
-    _watch_enable_tc0();
+    // tud_task runs in PendSV, which USB_Handler pends whenever the stack has queued an event. Give it the lowest
+    // priority, so the RTC, buttons and DMA all preempt it, and so it never runs on top of another handler.
+    NVIC_SetPriority(PendSV_IRQn, (1 << __NVIC_PRIO_BITS) - 1);
 
     tusb_init();
-
-    _watch_enable_tc1();
 }
 
 void USB_Handler(void) {
+    // the interrupt handler only queues events for the stack. instead of polling tud_task on a timer whether or
+    // not anything happened on the bus, we process them as soon as this handler returns.
     tud_int_handler(0);
+    SCB->ICSR = SCB_ICSR_PENDSVSET_Msk;
+}
+
+void PendSV_Handler(void) {
+    tud_task();
 }
 
 // USB Descriptors and tinyUSB callbacks follow.
@@ -26,7 +26,9 @@
 #include "watch_private_cdc.h"
 
 #include <stddef.h>
+#include <string.h>
 
+#include "watch.h"
 #include "watch_utility.h"
 #include "tusb.h"
 
@@ -51,14 +53,92 @@ static char s_read_buf[CDC_READ_BUF_SZ] = {0};
 static size_t s_read_buf_pos = 0;
 static size_t s_read_buf_len = 0;
 
-// Mask TC1 interrupts, preventing calls to cdc_task()
-static inline void prv_critical_section_enter(void) {
-    NVIC_DisableIRQ(TC1_IRQn);
+// Set when there may be work for cdc_task: data arrived from the host, the
+// host took the last packet we sent, or we have something new to send.
+// _write, _read and cdc_task all run on the main loop; the USB stack only
+// ever touches this flag, from its callbacks below.
+static volatile bool s_cdc_pending = false;
+
+// How many seconds _write will wait for the host to make room before it
+// gives up and starts dropping output.
+#define CDC_WRITE_TIMEOUT_S  (2)
+// Set when _write gave up on the host; until the host takes something again,
+// _write drops output instead of waiting on it.
+static volatile bool s_write_stalled = false;
+
+static watch_cdc_stats_t s_stats = {0};
+
+static void prv_handle_reads(void) {
+    while (tud_cdc_available()) {
+        int c = tud_cdc_read_char();
+        if (c < 0) {
+            continue;
+        }
+        s_read_buf[s_read_buf_pos] = c;
+        s_read_buf_pos = CDC_READ_BUF_IDX(s_read_buf_pos + 1);
+        if (s_read_buf_len < CDC_READ_BUF_SZ) {
+            s_read_buf_len++;
+        } else {
+            s_stats.rx_dropped++;
+        }
+    }
+}
+
+static void prv_handle_writes(void) {
+    while (s_write_buf_len > 0) {
+        if (tud_cdc_available() > 0) {
+            // If we receive data while doing a large write, we need to
+            // fully service it before continuing to write, or the
+            // stack will crash.
+            prv_handle_reads();
+        }
+        // Hand the stack the oldest data in one piece: everything up to
+        // the end of the data or the end of the buffer, whichever is first.
+        const size_t start_pos =
+            CDC_WRITE_BUF_IDX(s_write_buf_pos - s_write_buf_len);
+        const size_t span = min(s_write_buf_len, CDC_WRITE_BUF_SZ - start_pos);
+        const size_t sent = tud_cdc_write(&s_write_buf[start_pos], span);
+        if (sent == 0) {
+            // The stack's buffer is full. Leave the rest in ours; when
+            // the host takes this packet, tud_cdc_tx_complete_cb will
+            // bring us back around to send more.
+            break;
+        }
+        s_write_buf_len -= sent;
+    }
+    tud_cdc_write_flush();
 }
 
-// Unmask TC1 interrupts, allowing calls to cdc_task()
-static inline void prv_critical_section_exit(void) {
-    NVIC_EnableIRQ(TC1_IRQn);
+// Waits for the host to take some of the data in the write buffer. Returns
+// false if we can't wait (in an interrupt, or nobody has the port open), or
+// the host hasn't taken anything in CDC_WRITE_TIMEOUT_S seconds.
+static bool prv_wait_for_room(void) {
+    if (__get_IPSR() != 0 || s_write_stalled || !tud_cdc_connected() ||
+        !_watch_rtc_is_enabled()) {
+        return false;
+    }
+
+    const size_t len = s_write_buf_len;
+    uint8_t last_second = watch_rtc_get_date_time().unit.second;
+    uint8_t seconds = 0;
+
+    // The stack runs from its interrupt, so all we have to do here is move
+    // data along as it makes room.
+    while (s_write_buf_len >= len) {
+        if (s_cdc_pending) {
+            cdc_task();
+        }
+        const uint8_t second = watch_rtc_get_date_time().unit.second;
+        if (second != last_second) {
+            last_second = second;
+            if (++seconds > CDC_WRITE_TIMEOUT_S) {
+                s_write_stalled = true;
+                return false;
+            }
+        }
+    }
+
+    return true;
 }
 
 int _write(int file, char *ptr, int len) {
@@ -68,31 +148,46 @@ int _write(int file, char *ptr, int len) {
         return -1;
     }
 
-    int bytes_written = 0;
-
-    prv_critical_section_enter();
+    size_t bytes_written = 0;
 
-    for (int i = 0; i < len; i++) {
-        s_write_buf[s_write_buf_pos] = ptr[i];
-        s_write_buf_pos = CDC_WRITE_BUF_IDX(s_write_buf_pos + 1);
-        if (s_write_buf_len < CDC_WRITE_BUF_SZ) {
-            s_write_buf_len++;
+    while (bytes_written < (size_t) len) {
+        if (s_write_buf_len == CDC_WRITE_BUF_SZ && !prv_wait_for_room()) {
+            // Nobody is taking the data. Drop the rest, but report it as
+            // written: a short or failed write makes stdio retry, or stop
+            // printing altogether.
+            s_stats.tx_dropped += len - bytes_written;
+            break;
         }
-        bytes_written++;
-    }
 
-    prv_critical_section_exit();
+        // Copy in as much as fits, in at most two pieces around the end of
+        // the buffer.
+        const size_t n = min(CDC_WRITE_BUF_SZ - s_write_buf_len,
+                             (size_t) len - bytes_written);
+        const size_t span = min(n, CDC_WRITE_BUF_SZ - s_write_buf_pos);
+        memcpy(&s_write_buf[s_write_buf_pos], ptr + bytes_written, span);
+        memcpy(s_write_buf, ptr + bytes_written + span, n - span);
+        s_write_buf_pos = CDC_WRITE_BUF_IDX(s_write_buf_pos + n);
+        s_write_buf_len += n;
+        bytes_written += n;
+        s_cdc_pending = true;
+
+        // Hand as much as the stack will take to it now, rather than waiting
+        // for the next trip through the main loop; a long shell command may
+        // print a lot before it returns.
+        prv_handle_writes();
+    }
 
-    return bytes_written;
+    return len;
 }
 
 int _read(int file, char *ptr, int len) {
     (void) file;
 
-    prv_critical_section_enter();
+    // The main loop normally does this, but a shell command waiting for
+    // input doesn't return to it.
+    cdc_task();
 
     if (ptr == NULL || len <= 0 || s_read_buf_len == 0) {
-        prv_critical_section_exit();
         return -1;
     }
 
@@ -101,60 +196,46 @@ int _read(int file, char *ptr, int len) {
         len = s_read_buf_len;
     }
 
-    // Calculate the start of the circular buffer, and iterate from there
-    const size_t start_pos = CDC_READ_BUF_IDX(s_read_buf_pos - len);
+    // Hand out the oldest data first, so that a short read (the shell takes
+    // whatever is there in small pieces) leaves the rest in order.
+    const size_t start_pos = CDC_READ_BUF_IDX(s_read_buf_pos - s_read_buf_len);
     for (size_t i = 0; i < (size_t) len; i++) {
-        const size_t idx = CDC_READ_BUF_IDX(start_pos + i);
-        ptr[i] = s_read_buf[idx];
-        s_read_buf[idx] = 0;
+        ptr[i] = s_read_buf[CDC_READ_BUF_IDX(start_pos + i)];
     }
 
-    // Update circular buffer position and length
     s_read_buf_len -= len;
-    s_read_buf_pos = CDC_READ_BUF_IDX(s_read_buf_pos - len);
-
-    prv_critical_section_exit();
 
     return len;
 }
 
-static void prv_handle_reads(void) {
-    while (tud_cdc_available()) {
-        int c = tud_cdc_read_char();
-        if (c < 0) {
-            continue;
-        }
-        s_read_buf[s_read_buf_pos] = c;
-        s_read_buf_pos = CDC_READ_BUF_IDX(s_read_buf_pos + 1);
-        if (s_read_buf_len < CDC_READ_BUF_SZ) {
-            s_read_buf_len++;
-        }
-    }
-}
-
-static void prv_handle_writes(void) {
-    if (s_write_buf_len > 0) {
-        const size_t start_pos =
-            CDC_WRITE_BUF_IDX(s_write_buf_pos - s_write_buf_len);
-        for (size_t i = 0; i < (size_t) s_write_buf_len; i++) {
-            const size_t idx = CDC_WRITE_BUF_IDX(start_pos + i);
-            if (tud_cdc_available() > 0) {
-                // If we receive data while doing a large write, we need to
-                // fully service it before continuing to write, or the
-                // stack will crash.
-                prv_handle_reads();
-            }
-            if (tud_cdc_write_available()) {
-                tud_cdc_write(&s_write_buf[idx], 1);
-            }
-            s_write_buf[idx] = 0;
-            s_write_buf_len--;
-        }
-        tud_cdc_write_flush();
-    }
+bool cdc_task_pending(void) {
+    return s_cdc_pending;
 }
 
 void cdc_task(void) {
+    if (!s_cdc_pending) {
+        return;
+    }
+    // Clear the flag before doing the work, so that anything that comes in
+    // while we're at it gets us back here next time.
+    s_cdc_pending = false;
     prv_handle_reads();
     prv_handle_writes();
 }
+
+// Called by tud_task when the host has sent us data.
+void tud_cdc_rx_cb(uint8_t itf) {
+    (void) itf;
+    s_cdc_pending = true;
+}
+
+// Called by tud_task when the host has taken a packet we sent.
+void tud_cdc_tx_complete_cb(uint8_t itf) {
+    (void) itf;
+    s_write_stalled = false;
+    s_cdc_pending = true;
+}
+
+const watch_cdc_stats_t *watch_get_cdc_stats(void) {
+    return &s_stats;
+}
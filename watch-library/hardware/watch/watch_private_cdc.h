@@ -26,8 +26,11 @@
 #ifndef _WATCH_PRIVATE_CDC_H_INCLUDED
 #define _WATCH_PRIVATE_CDC_H_INCLUDED
 
+#include <stdbool.h>
+
 int _write(int file, char *ptr, int len);
 int _read(int file, char *ptr, int len);
 void cdc_task(void);
+bool cdc_task_pending(void);
 
 #endif
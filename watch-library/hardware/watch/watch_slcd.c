@@ -46,10 +46,16 @@ inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
     slcd_sync_seg_off(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
 }
 
+bool watch_get_pixel(uint8_t com, uint8_t seg) {
+    // SDATAL0, SDATAH0, SDATAL1...: our segments all fit in the low register for each common.
+    return (((uint32_t *)&SLCD->SDATAL0)[com * 2] >> seg) & 1;
+}
+
 void watch_clear_display(void) {
     SLCD->SDATAL0.reg = 0;
     SLCD->SDATAL1.reg = 0;
     SLCD->SDATAL2.reg = 0;
+    _watch_display_clear_characters();
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -37,15 +37,85 @@ void watch_disable_spi(void) {
     spi_io = NULL;
 }
 
+bool watch_is_spi_enabled(void) {
+    return spi_io != NULL;
+}
+
+// transfers shorter than this go a byte at a time; setting up the DMAC for them would cost more than it saves.
+// anything longer is moved by the DMAC while the CPU sleeps.
+#define WATCH_SPI_DMA_THRESHOLD 16
+
+static volatile bool _spi_dma_done;
+
+static void _watch_spi_dma_complete(void) {
+    _spi_dma_done = true;
+}
+
+static void _watch_spi_dma_start(uint8_t channel, uint8_t trigger) {
+    hri_dmac_write_CHID_reg(DMAC, channel);
+    hri_dmac_write_CHCTRLB_reg(DMAC, DMAC_CHCTRLB_TRIGSRC(trigger) | DMAC_CHCTRLB_TRIGACT_BEAT);
+    if (channel == WATCH_DMA_CHANNEL_SPI_RX) hri_dmac_set_CHINTEN_TCMPL_bit(DMAC);
+    hri_dmac_set_CHCTRLA_ENABLE_bit(DMAC);
+}
+
+/// @brief Runs a full-duplex transfer on the DMAC: one channel feeds the transmitter, one drains the receiver.
+/// @param data_out The bytes to send, or NULL to send the dummy byte.
+/// @param data_in Storage for the received bytes, or NULL to throw them away.
+static bool _watch_spi_dma_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    static const uint8_t dummy_out = 0xFF;
+    static uint8_t dummy_in;
+    Sercom *sercom = SERCOM3;
+
+    // the DMAC wants the address one past the end of a buffer it increments through.
+    DmacDescriptor *rx = _watch_dma_get_descriptor(WATCH_DMA_CHANNEL_SPI_RX);
+    rx->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (data_in != NULL ? DMAC_BTCTRL_DSTINC : 0);
+    rx->BTCNT.reg = length;
+    rx->SRCADDR.reg = (uint32_t)&sercom->SPI.DATA.reg;
+    rx->DSTADDR.reg = data_in != NULL ? (uint32_t)(data_in + length) : (uint32_t)&dummy_in;
+    rx->DESCADDR.reg = 0;
+
+    DmacDescriptor *tx = _watch_dma_get_descriptor(WATCH_DMA_CHANNEL_SPI_TX);
+    tx->BTCTRL.reg = DMAC_BTCTRL_VALID | DMAC_BTCTRL_BEATSIZE_BYTE | (data_out != NULL ? DMAC_BTCTRL_SRCINC : 0);
+    tx->BTCNT.reg = length;
+    tx->SRCADDR.reg = data_out != NULL ? (uint32_t)(data_out + length) : (uint32_t)&dummy_out;
+    tx->DSTADDR.reg = (uint32_t)&sercom->SPI.DATA.reg;
+    tx->DESCADDR.reg = 0;
+
+    // throw away anything left in the receiver, so the RX channel only sees bytes from this transfer.
+    while (sercom->SPI.INTFLAG.reg & SERCOM_SPI_INTFLAG_RXC) (void)sercom->SPI.DATA.reg;
+    sercom->SPI.STATUS.reg = SERCOM_SPI_STATUS_BUFOVF;
+
+    _spi_dma_done = false;
+    _watch_dma_set_callback(WATCH_DMA_CHANNEL_SPI_RX, _watch_spi_dma_complete);
+    __disable_irq();
+    _watch_spi_dma_start(WATCH_DMA_CHANNEL_SPI_RX, SERCOM3_DMAC_ID_RX);
+    // the transmitter is empty, so this starts the transfer.
+    _watch_spi_dma_start(WATCH_DMA_CHANNEL_SPI_TX, SERCOM3_DMAC_ID_TX);
+    __enable_irq();
+
+    // the last byte received is the last byte sent, so the RX channel finishing means the whole transfer is done.
+    while (!_spi_dma_done) {
+        __disable_irq();
+        if (!_spi_dma_done) sleep(2);   // IDLE: the CPU stops, but the DMAC and SERCOM keep going.
+        __enable_irq();
+    }
+    _watch_dma_set_callback(WATCH_DMA_CHANNEL_SPI_RX, NULL);
+
+    return true;
+}
+
 bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_transfer(buf, NULL, length);
 	return !!io_write(spi_io, buf, length);
 }
 
 bool watch_spi_read(uint8_t *buf, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_transfer(NULL, buf, length);
 	return !!io_read(spi_io, buf, length);
 }
 
 bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    if (length >= WATCH_SPI_DMA_THRESHOLD) return _watch_spi_dma_transfer(data_out, data_in, length);
     struct spi_xfer xfer;
     xfer.txbuf = (uint8_t *)data_out;
     xfer.rxbuf = data_in;
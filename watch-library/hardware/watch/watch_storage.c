@@ -47,17 +47,23 @@ bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t
     return true;
 }
 
-bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
-    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
-    if (!_is_valid_address(address, size)) return false;
+// called from the NVMCTRL interrupt when an asynchronous erase or write has finished.
+static void (*_storage_callback)(void);
 
-    watch_storage_sync();
+static void _watch_storage_enable_ready_interrupt(void) {
+    hri_nvmctrl_set_INTEN_READY_bit(NVMCTRL);
+    NVIC_ClearPendingIRQ(NVMCTRL_IRQn);
+    NVIC_EnableIRQ(NVMCTRL_IRQn);
+}
 
+static void _watch_storage_start_write(uint32_t address, const uint8_t *buffer, uint32_t size) {
     uint32_t nvm_address = address / 2;
     uint16_t i, data;
 
+    // clearing the page buffer only takes a few cycles, so there's no point sleeping through it.
     hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_PBC | NVMCTRL_CTRLA_CMDEX_KEY);
-    watch_storage_sync();
+    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL));
+    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
 
     for (i = 0; i < size; i += 2) {
         data = buffer[i];
@@ -68,6 +74,19 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
     }
     hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
     hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEWP | NVMCTRL_CTRLA_CMDEX_KEY);
+}
+
+static void _watch_storage_start_erase(uint32_t address) {
+    hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
+    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY);
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
+    if (!_is_valid_address(address, size)) return false;
+
+    watch_storage_sync();
+    _watch_storage_start_write(address, buffer, size);
 
     return true;
 }
@@ -77,18 +96,65 @@ bool watch_storage_erase(uint32_t row) {
     if (!_is_valid_address(address, NVMCTRL_ROW_SIZE)) return false;
 
     watch_storage_sync();
-    hri_nvmctrl_write_ADDR_reg(NVMCTRL, address / 2);
-    hri_nvmctrl_write_CTRLA_reg(NVMCTRL, NVMCTRL_CTRLA_CMD_RWWEEER | NVMCTRL_CTRLA_CMDEX_KEY);
+    _watch_storage_start_erase(address);
+
+    return true;
+}
+
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, void (*callback)(void)) {
+    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE + offset;
+    if (!_is_valid_address(address, size)) return false;
+    if (watch_storage_is_busy()) return false;
+
+    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
+    _storage_callback = callback;
+    _watch_storage_start_write(address, buffer, size);
+    _watch_storage_enable_ready_interrupt();
 
     return true;
 }
 
+bool watch_storage_erase_async(uint32_t row, void (*callback)(void)) {
+    uint32_t address = RWWEE_ADDR_START + row * NVMCTRL_ROW_SIZE;
+    if (!_is_valid_address(address, NVMCTRL_ROW_SIZE)) return false;
+    if (watch_storage_is_busy()) return false;
+
+    hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
+    _storage_callback = callback;
+    _watch_storage_start_erase(address);
+    _watch_storage_enable_ready_interrupt();
+
+    return true;
+}
+
+bool watch_storage_is_busy(void) {
+    return !hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL);
+}
+
 bool watch_storage_sync(void) {
-    while (!hri_nvmctrl_get_interrupt_READY_bit(NVMCTRL)) {
-        // wait for flash to become ready
+    // a row erase takes several milliseconds; instead of spinning, sleep until the READY interrupt wakes us.
+    // interrupts stay masked between checking READY and sleeping, so we can't miss the wakeup: WFI still
+    // returns on a pending interrupt, and the handler runs as soon as we unmask.
+    while (watch_storage_is_busy()) {
+        __disable_irq();
+        if (watch_storage_is_busy()) {
+            _watch_storage_enable_ready_interrupt();
+            sleep(2);   // IDLE: the CPU stops, but clocks and peripherals keep running.
+        }
+        __enable_irq();
     }
 
     hri_nvmctrl_clear_STATUS_reg(NVMCTRL, NVMCTRL_STATUS_MASK);
 
     return true;
 }
+
+void NVMCTRL_Handler(void) {
+    // READY is a level, not an event: it stays set until the next command, so mask it or it will fire forever.
+    hri_nvmctrl_clear_INTEN_READY_bit(NVMCTRL);
+    if (_storage_callback != NULL) {
+        void (*callback)(void) = _storage_callback;
+        _storage_callback = NULL;
+        callback();
+    }
+}
@@ -28,7 +28,14 @@
 
 #include "spiflash.h"
 
-#define SPI_FLASH_FAST_READ false
+// FAST_READ sends one dummy byte after the address, but it's the read command that every part is rated to run at
+// its full clock, so the SPI clock can go up without revisiting this.
+#define SPI_FLASH_FAST_READ true
+
+// a program or erase has been started and may not have finished; the next command has to wait for it.
+static bool spi_flash_busy = false;
+// the chip is in deep power-down, and needs waking before it will listen to anything but CMD_WAKE.
+static bool spi_flash_powered_down = false;
 
 static void flash_enable(void) {
     watch_set_pin_level(A3, false);
@@ -38,7 +45,52 @@ static void flash_disable(void) {
     watch_set_pin_level(A3, true);
 }
 
+static void wake_if_needed(void) {
+    if (!spi_flash_powered_down) return;
+    uint8_t command = CMD_WAKE;
+    flash_enable();
+    watch_spi_write(&command, 1);
+    flash_disable();
+    spi_flash_powered_down = false;
+    // the chip ignores us until tRES1 has passed. delay_us would take SysTick away from the cycle timer that the
+    // filesystem stats are measuring this access with, so spin instead; each pass takes at least one cycle.
+    uint32_t cycles = SPI_FLASH_WAKE_US * (4 << watch_get_cpu_speed());
+    for (volatile uint32_t i = 0; i < cycles; i++);
+}
+
+bool spi_flash_wait_ready(void) {
+    wake_if_needed();
+    if (!spi_flash_busy) return true;
+    // the status register is sent over and over for as long as chip select stays low, so read it without
+    // sending the command again every time.
+    uint8_t command = CMD_READ_STATUS;
+    uint8_t status;
+    flash_enable();
+    bool ok = watch_spi_write(&command, 1);
+    do {
+        ok = ok && watch_spi_read(&status, 1);
+    } while (ok && (status & 0x01));
+    flash_disable();
+    spi_flash_busy = !ok;
+    return ok;
+}
+
+void spi_flash_power_down(void) {
+    if (spi_flash_powered_down) return;
+    // the chip ignores the command while a program or erase is in progress.
+    spi_flash_wait_ready();
+    uint8_t command = CMD_DEEP_POWER_DOWN;
+    flash_enable();
+    watch_spi_write(&command, 1);
+    flash_disable();
+    spi_flash_powered_down = true;
+}
+
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
+    // status reads are how callers wait for the chip themselves, so let them through while it's busy.
+    if (command[0] == CMD_READ_STATUS) wake_if_needed();
+    else spi_flash_wait_ready();
+    flash_enable();
     bool status = watch_spi_write(command, command_length);
     if (status) {
         if (data_in != NULL && data_out != NULL) {
@@ -79,22 +131,42 @@ static void address_to_bytes(uint32_t address, uint8_t *bytes) {
 bool spi_flash_sector_command(uint8_t command, uint32_t address) {
     uint8_t request[4] = {command, 0x00, 0x00, 0x00};
     address_to_bytes(address, request + 1);
-    return transfer(request, 4, NULL, NULL, 0);
+    bool status = transfer(request, 4, NULL, NULL, 0);
+    if (command == CMD_SECTOR_ERASE || command == CMD_CHIP_ERASE) spi_flash_busy = true;
+    return status;
 }
 
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length) {
     uint8_t request[4] = {CMD_PAGE_PROGRAM, 0x00, 0x00, 0x00};
     // Write the SPI flash write address into the bytes following the command byte.
     address_to_bytes(address, request + 1);
+    spi_flash_wait_ready();
     flash_enable();
     bool status = watch_spi_write(request, 4);
     if (status) {
         status = watch_spi_write(data, data_length);
     }
     flash_disable();
+    // don't wait for the program cycle here: the caller can get on with filling its next buffer in the meantime,
+    // and whatever talks to the chip next waits for it to finish.
+    spi_flash_busy = true;
     return status;
 }
 
+bool spi_flash_program(uint32_t address, uint8_t *data, uint32_t data_length) {
+    while (data_length) {
+        // a page program wraps around at the end of the page, so split the write at page boundaries.
+        uint32_t chunk = SPI_FLASH_PAGE_SIZE - (address % SPI_FLASH_PAGE_SIZE);
+        if (chunk > data_length) chunk = data_length;
+        if (!spi_flash_command(CMD_ENABLE_WRITE) || !spi_flash_write_data(address, data, chunk)) return false;
+        address += chunk;
+        data += chunk;
+        data_length -= chunk;
+    }
+
+    return true;
+}
+
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length) {
     uint8_t request[5] = {CMD_READ_DATA, 0x00, 0x00, 0x00};
     uint8_t command_length = 4;
@@ -104,6 +176,7 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
     }
     // Write the SPI flash read address into the bytes following the command byte.
     address_to_bytes(address, request + 1);
+    spi_flash_wait_ready();
     flash_enable();
     bool status = watch_spi_write(request, command_length);
     if (status) {
@@ -117,4 +190,6 @@ void spi_flash_init(void) {
 	gpio_set_pin_level(A3, true);
 	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
     watch_enable_spi();
+    // the chip may have been left in deep power-down; waking one that's already awake does no harm.
+    spi_flash_powered_down = true;
 }
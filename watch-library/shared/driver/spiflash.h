@@ -48,6 +48,11 @@
 #define CMD_ENABLE_RESET 0x66
 #define CMD_RESET 0x99
 #define CMD_WAKE 0xab
+#define CMD_DEEP_POWER_DOWN 0xb9
+
+#define SPI_FLASH_PAGE_SIZE 256
+// tRES1, the time it takes to wake from deep power-down; at most 30 µs on the parts we've seen.
+#define SPI_FLASH_WAKE_US 30
 
 bool spi_flash_command(uint8_t command);
 bool spi_flash_read_command(uint8_t command, uint8_t *response, uint32_t length);
@@ -56,3 +61,19 @@ bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length);
 void spi_flash_init(void);
+
+/** @brief Programs any number of bytes, one page program at a time. You must erase the range first.
+  * @details Like spi_flash_write_data, this returns as soon as the last page has been sent, without waiting for
+  *          it to be programmed. Whatever talks to the chip next waits for that.
+  */
+bool spi_flash_program(uint32_t address, uint8_t *data, uint32_t data_length);
+
+/** @brief Waits for a program or erase to finish. The other functions do this for you before they send
+  *        anything; call it if you need to know that the data is really in the flash.
+  */
+bool spi_flash_wait_ready(void);
+
+/** @brief Puts the chip in deep power-down, where it draws about a microamp instead of tens. It wakes up by
+  *        itself the next time you call any of the other functions.
+  */
+void spi_flash_power_down(void);
@@ -0,0 +1,88 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Host tests for the fixed-point helpers. They borrow Unity from the chirpy_tx tests; build and run them with:
+//
+//     U=../../../../movement/lib/chirpy_tx/test
+//     gcc -o test_watch_fixed_math test_watch_fixed_math.c ../watch_fixed_math.c $U/unity.c -I$U && ./test_watch_fixed_math
+
+#include <stdint.h>
+#include "../watch_fixed_math.h"
+#include "unity.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+static void test_julian_day_number(void) {
+  // J2000.0 falls at noon on this day, and the Unix epoch at the midnight before its noon.
+  TEST_ASSERT_EQUAL_INT32(2451545, watch_fixed_julian_day_number(2000, 1, 1));
+  TEST_ASSERT_EQUAL_INT32(2440588, watch_fixed_julian_day_number(1970, 1, 1));
+  // the start of the modified Julian date is midnight at the start of 1858-11-17, JD 2400000.5.
+  TEST_ASSERT_EQUAL_INT32(2400001, watch_fixed_julian_day_number(1858, 11, 17));
+  // the end of February, in a leap year, a century that isn't one, and a normal year.
+  TEST_ASSERT_EQUAL_INT32(watch_fixed_julian_day_number(2024, 3, 1) - 2, watch_fixed_julian_day_number(2024, 2, 28));
+  TEST_ASSERT_EQUAL_INT32(watch_fixed_julian_day_number(2100, 3, 1) - 1, watch_fixed_julian_day_number(2100, 2, 28));
+  TEST_ASSERT_EQUAL_INT32(watch_fixed_julian_day_number(2023, 3, 1) - 1, watch_fixed_julian_day_number(2023, 2, 28));
+  TEST_ASSERT_EQUAL_INT32(watch_fixed_julian_day_number(2025, 1, 1) - 366, watch_fixed_julian_day_number(2024, 1, 1));
+}
+
+static void test_julian_date_from_unix_time(void) {
+  TEST_ASSERT_TRUE(watch_fixed_julian_date_from_unix_time(0) == WATCH_FIXED_JD_UNIX_EPOCH);
+  // 2000-01-01 12:00 UTC, which is a whole number of millionths of a day after the epoch.
+  TEST_ASSERT_TRUE(watch_fixed_julian_date_from_unix_time(946728000) == WATCH_FIXED_JD_J2000);
+  // one second is 11.57 millionths of a day, rounded down.
+  TEST_ASSERT_TRUE(watch_fixed_julian_date_from_unix_time(1) == WATCH_FIXED_JD_UNIX_EPOCH + 11);
+  // midnight at the start of a day is half a day before that day's number.
+  int64_t midnight = (int64_t)watch_fixed_julian_day_number(2024, 6, 21) * 1000000 - 500000;
+  TEST_ASSERT_TRUE(watch_fixed_julian_date_from_unix_time(1718928000) == midnight);
+}
+
+static void test_unix_time_from_julian_date(void) {
+  TEST_ASSERT_EQUAL_UINT32(0, watch_fixed_unix_time_from_julian_date(WATCH_FIXED_JD_UNIX_EPOCH));
+  TEST_ASSERT_EQUAL_UINT32(946728000, watch_fixed_unix_time_from_julian_date(WATCH_FIXED_JD_J2000));
+  // half a second past the epoch rounds down.
+  TEST_ASSERT_EQUAL_UINT32(0, watch_fixed_unix_time_from_julian_date(WATCH_FIXED_JD_UNIX_EPOCH + 5));
+  // so does 0.86 s past it, the last millionth of a day before the next second; the bias doesn't reach that far.
+  TEST_ASSERT_EQUAL_UINT32(0, watch_fixed_unix_time_from_julian_date(WATCH_FIXED_JD_UNIX_EPOCH + 10));
+}
+
+static void test_julian_date_round_trip(void) {
+  // every second of a day, and then a spread of times out to 2106.
+  for (uint32_t t = 1700000000; t < 1700000000 + 86400; t++)
+    TEST_ASSERT_EQUAL_UINT32(t, watch_fixed_unix_time_from_julian_date(watch_fixed_julian_date_from_unix_time(t)));
+  for (uint32_t t = 0; t < 0xFFFF0000; t += 65521)
+    TEST_ASSERT_EQUAL_UINT32(t, watch_fixed_unix_time_from_julian_date(watch_fixed_julian_date_from_unix_time(t)));
+}
+
+int main(void) {
+  UNITY_BEGIN();
+  RUN_TEST(test_julian_day_number);
+  RUN_TEST(test_julian_date_from_unix_time);
+  RUN_TEST(test_unix_time_from_julian_date);
+  RUN_TEST(test_julian_date_round_trip);
+  return UNITY_END();
+}
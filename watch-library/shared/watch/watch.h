@@ -87,14 +87,78 @@ bool watch_is_buzzer_or_led_enabled(void);
   */
 bool watch_is_usb_enabled(void);
 
+/// @brief The speeds that the main clock can run at. @see watch_set_cpu_speed
+typedef enum {
+    WATCH_CPU_SPEED_4_MHZ = 0,  ///< The default.
+    WATCH_CPU_SPEED_8_MHZ,      ///< The speed the watch runs at while USB is enabled.
+    WATCH_CPU_SPEED_16_MHZ,     ///< The fastest speed available without the DFLL.
+} watch_cpu_speed_t;
+
+/** @brief Changes the speed of the main clock, which runs the CPU and most peripherals.
+  * @details The watch normally runs at 4 MHz. A burst of heavy math finishes sooner at a higher speed, and
+  *          the watch can go back to sleep sooner. The buzzer and LED are adjusted so that tones and PWM keep
+  *          the same periods, and delay_ms keeps counting real milliseconds. The I2C, SPI, UART and ADC
+  *          peripherals work out their baud rates and prescalers when you enable them, so you should not
+  *          change speed while they are enabled. USB needs an 8 MHz clock, so this function does nothing
+  *          while USB is enabled.
+  * @param speed The new speed.
+  */
+void watch_set_cpu_speed(watch_cpu_speed_t speed);
+
+/** @brief Returns the current speed of the main clock.
+  */
+watch_cpu_speed_t watch_get_cpu_speed(void);
+
+/** @brief Starts a timer that counts CPU clock cycles, for timing short stretches of code.
+  * @details This uses SysTick, which delay_ms and delay_us also use, so don't call those before reading
+  *          the timer. It only counts while the CPU is awake, and wraps after 2^24 cycles (about four
+  *          seconds at 4 MHz).
+  */
+void watch_cycle_timer_start(void);
+
+/** @brief Returns the number of microseconds since watch_cycle_timer_start, at the current CPU speed.
+  */
+uint32_t watch_cycle_timer_get_us(void);
+
+/// @brief How long each stage of the last boot took, in microseconds. @see watch_get_boot_times
+typedef struct {
+    uint32_t init_mcu;      ///< Clocks, power and USB.
+    uint32_t app_init;      ///< The app's app_init function.
+    uint32_t rtc;           ///< Starting the RTC and restoring the date and time.
+    uint32_t app_setup;     ///< The app's app_setup function.
+} watch_boot_times_t;
+
+/** @brief Returns how long each stage of the last boot took.
+  */
+const watch_boot_times_t *watch_get_boot_times(void);
+
+/** @brief Returns the number of microseconds since the watch started booting, in steps of 16 µs at 4 MHz and
+  *        less at higher CPU speeds. Use this to time parts of your app_init or app_setup.
+  * @return The time since boot began, or 0 if boot is over and the timer has been stopped. The LED driver
+  *         also stops it if something asks for an LED fade, blink or timeout during boot.
+  */
+uint32_t watch_get_boot_timer_us(void);
+
 /** @brief Resets in the UF2 bootloader mode
   */
 void watch_reset_to_bootloader(void);
 
-/** @brief Call periodically from app main loop to service CDC RX/TX.
+/** @brief Services CDC RX/TX. The main loop calls this for you whenever the USB stack has data for it, so
+  *        you only need to call it if your app waits for serial data without returning from app_loop.
   */
 void cdc_task(void);
 
+/// @brief Bytes the USB serial port has had to throw away since boot. @see watch_get_cdc_stats
+typedef struct {
+    uint32_t tx_dropped;    ///< Written while nobody had the port open, or the host had stopped reading.
+    uint32_t rx_dropped;    ///< Received while the read buffer was full.
+} watch_cdc_stats_t;
+
+/** @brief Returns how many bytes the USB serial port has dropped. Writes to a full buffer wait for the host
+  *        to make room, so output is only dropped when no one is listening. Always zero in the simulator.
+  */
+const watch_cdc_stats_t *watch_get_cdc_stats(void);
+
 /** @brief Reads up to len bytes from the USB serial.
   * @param file ignored, you can pass in 0
   * @param ptr pointer to a buffer of at least len bytes
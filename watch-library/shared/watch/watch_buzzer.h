@@ -149,14 +149,40 @@ typedef enum BuzzerNote {
     BUZZER_NOTE_REST             ///< no sound
 } BuzzerNote;
 
+/// @brief A note and how long to play it, for watch_buzzer_play_notes.
+typedef struct {
+    BuzzerNote note;
+    uint16_t duration_ms;
+} watch_buzzer_note_t;
+
 /** @brief Plays the given note for a set duration.
   * @param note The note you wish to play, or BUZZER_NOTE_REST to disable output for the given duration.
   * @param duration_ms The duration of the note.
   * @note Note that this will block your UI for the duration of the note's play time, and it will
-  *       after this call, the buzzer period will be set to the period of this note.
+  *       after this call, the buzzer period will be set to the period of this note. On hardware it sleeps while
+  *       the note plays, unless a sequence is already playing, in which case it plays over it without stopping
+  *       it. Consider watch_buzzer_play_note_async instead.
   */
 void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms);
 
+/** @brief Starts playing the given note for a set duration, and returns right away.
+  * @param note The note you wish to play, or BUZZER_NOTE_REST for silence.
+  * @param duration_ms The duration of the note, to the nearest 2 ms on hardware and 16 ms in the simulator.
+  * @param callback_on_end A function to call when the note has finished, or NULL. It is called from an interrupt.
+  * @note This plays the note as a sequence of one, so it stops any sequence that is playing, and
+  *       watch_buzzer_abort_sequence stops it.
+  */
+void watch_buzzer_play_note_async(BuzzerNote note, uint16_t duration_ms, void (*callback_on_end)(void));
+
+/** @brief Starts playing a short pattern of notes, and returns right away.
+  * @param notes The notes, which must stay where they are until they've played; make the array static const.
+  * @param count The number of notes.
+  * @param callback_on_end A function to call when the last note has finished, or NULL. It is called from an
+  *        interrupt.
+  * @note Like watch_buzzer_play_note_async, this stops any sequence that is playing.
+  */
+void watch_buzzer_play_notes(const watch_buzzer_note_t *notes, uint8_t count, void (*callback_on_end)(void));
+
 /// @brief An array of periods for all the notes on a piano, corresponding to the names in BuzzerNote.
 extern const uint16_t NotePeriods[108];
 
@@ -168,20 +194,38 @@ extern const uint16_t NotePeriods[108];
   *        the tuple -3, 1. The repeated notes must not contain any other repeat markers, or you will end up with 
   *        an eternal loop.
   * @param callback_on_end A pointer to a callback function to be invoked when the sequence has finished playing.
-  * @note This function plays the sequence asynchronously, so the UI will not be blocked. 
+  *        It is called from an interrupt.
+  * @note This function plays the sequence asynchronously, so the UI will not be blocked. The notes are fed to the
+  *       buzzer by the DMA controller, so the watch can stay in standby while they play.
   *       Hint: It is not possible to play the lowest note BUZZER_NOTE_A1 (55.00 Hz). The note is represented by a 
   *       zero byte, which is used here as the end-of-sequence marker. But hey, a frequency that low cannot be
   *       played properly by the watch's buzzer, anyway.
   */
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void));
 
+/** @brief Plays a tune in the compressed format utils/tune_converter.py writes, in a non-blocking way.
+  * @param tune A pointer to the compressed tune, i.e. one of movement's signal_tunes.
+  * @param callback_on_end A pointer to a callback function to be invoked when the tune has finished playing.
+  *        It is called from an interrupt.
+  * @note The tune is decoded a few notes at a time while it plays, so it never needs to be expanded in RAM.
+  *       It starts with a byte giving the length of a table of durations, and then the table, one byte each.
+  *       Each note is then a byte whose top five bits are its pitch: 0 is a rest, 1 to 30 are the last pitch
+  *       (BUZZER_NOTE_A4 at the start) moved by -15 to +14 semitones, and 31 means the BuzzerNote follows in the
+  *       next byte. The bottom three bits are its duration: 1 to 7 pick from the table, and 0 means the duration
+  *       follows, seven bits to a byte, lowest first, with the top bit set on all but the last byte. Durations
+  *       are in 64ths of a second less one, as in a sequence. A zero byte ends the tune.
+  */
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void));
+
 /** @brief Aborts a playing sequence.
   */
 void watch_buzzer_abort_sequence(void);
 
-#ifndef __EMSCRIPTEN__
-void TC3_Handler(void);
-#endif
+/** @brief Sleeps until the sequence that is playing has finished, or returns right away if none is.
+  * @note On hardware this waits in standby (or in idle, when USB is connected), since the DMA controller plays
+  *       the notes without the CPU. The simulator can't block the browser, so there it just returns.
+  */
+void watch_buzzer_wait_for_sequence(void);
 
 /// @}
 #endif
@@ -0,0 +1,135 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include "watch_fixed_math.h"
+
+// sin(x) for x in [0, pi/2] in 64 steps, Q15.
+static const int16_t _watch_fixed_sine_table[65] = {
+    0, 804, 1608, 2411, 3212, 4011, 4808, 5602,
+    6393, 7180, 7962, 8740, 9512, 10279, 11039, 11793,
+    12540, 13279, 14010, 14733, 15447, 16151, 16846, 17531,
+    18205, 18868, 19520, 20160, 20788, 21403, 22006, 22595,
+    23170, 23732, 24279, 24812, 25330, 25833, 26320, 26791,
+    27246, 27684, 28106, 28511, 28899, 29269, 29622, 29957,
+    30274, 30572, 30853, 31114, 31357, 31581, 31786, 31972,
+    32138, 32286, 32413, 32522, 32610, 32679, 32729, 32758,
+    32767
+};
+
+// log2(1 + x) for x in [0, 1) in 64 steps, Q16. log2(2) = 65536 is implied as the last entry.
+static const uint16_t _watch_fixed_log2_table[64] = {
+    0, 1466, 2909, 4331, 5732, 7112, 8473, 9814,
+    11136, 12440, 13727, 14996, 16248, 17484, 18704, 19909,
+    21098, 22272, 23433, 24579, 25711, 26830, 27936, 29029,
+    30109, 31178, 32234, 33279, 34312, 35334, 36346, 37346,
+    38336, 39316, 40286, 41246, 42196, 43137, 44068, 44990,
+    45904, 46809, 47705, 48593, 49472, 50344, 51207, 52063,
+    52911, 53751, 54584, 55410, 56229, 57040, 57845, 58643,
+    59434, 60219, 60997, 61769, 62534, 63294, 64047, 64794
+};
+
+// ln(2) in Q16
+#define WATCH_FIXED_LN2 45426
+
+int32_t watch_fixed_wrap(int32_t x, int32_t y) {
+    int32_t result = x % y;
+    if (result < 0) result += y;
+    return result;
+}
+
+int64_t watch_fixed_wrap64(int64_t x, int64_t y) {
+    int64_t result = x % y;
+    if (result < 0) result += y;
+    return result;
+}
+
+uint16_t watch_fixed_angle_from_centidegrees(int32_t centidegrees) {
+    return (uint16_t)(((uint32_t)watch_fixed_wrap(centidegrees, 36000) << 16) / 36000);
+}
+
+// sine of the first quadrant; position is 0 to 16384 inclusive.
+static int16_t _watch_fixed_quarter_sin(uint16_t position) {
+    uint8_t i = position >> 8;
+    if (i >= 64) return _watch_fixed_sine_table[64];
+    int32_t lo = _watch_fixed_sine_table[i];
+    int32_t hi = _watch_fixed_sine_table[i + 1];
+    return lo + (((hi - lo) * (position & 0xFF)) >> 8);
+}
+
+int16_t watch_fixed_sin(uint16_t angle) {
+    uint16_t position = angle & 0x3FFF;
+    switch (angle >> 14) {
+        case 0:
+            return _watch_fixed_quarter_sin(position);
+        case 1:
+            return _watch_fixed_quarter_sin(0x4000 - position);
+        case 2:
+            return -_watch_fixed_quarter_sin(position);
+        default:
+            return -_watch_fixed_quarter_sin(0x4000 - position);
+    }
+}
+
+int16_t watch_fixed_cos(uint16_t angle) {
+    return watch_fixed_sin(angle + 0x4000);
+}
+
+int32_t watch_fixed_log2(uint32_t x) {
+    if (x == 0) return INT32_MIN;
+
+    // split x into a power of two and a mantissa in [1, 2)
+    int8_t exponent = 31 - __builtin_clz(x);
+    uint32_t mantissa = exponent >= 16 ? x >> (exponent - 16) : x << (16 - exponent);
+    uint16_t fraction = mantissa - WATCH_FIXED_Q16_ONE;
+
+    uint8_t i = fraction >> 10;
+    int32_t lo = _watch_fixed_log2_table[i];
+    int32_t hi = i < 63 ? _watch_fixed_log2_table[i + 1] : WATCH_FIXED_Q16_ONE;
+
+    return (exponent - 16) * WATCH_FIXED_Q16_ONE + lo + (((hi - lo) * (fraction & 0x3FF)) >> 10);
+}
+
+int32_t watch_fixed_log(uint32_t x) {
+    int32_t log2 = watch_fixed_log2(x);
+    if (log2 == INT32_MIN) return INT32_MIN;
+    return ((int64_t)log2 * WATCH_FIXED_LN2) >> 16;
+}
+
+int32_t watch_fixed_julian_day_number(uint16_t year, uint8_t month, uint8_t day) {
+    // Fliegel & Van Flandern, shifted so that the year starts in March.
+    int32_t a = (14 - month) / 12;
+    int32_t y = year + 4800 - a;
+    int32_t m = month + 12 * a - 3;
+    return day + (153 * m + 2) / 5 + 365 * y + y / 4 - y / 100 + y / 400 - 32045;
+}
+
+int64_t watch_fixed_julian_date_from_unix_time(uint32_t timestamp) {
+    // 1000000 / 86400 reduces to 625 / 54
+    return WATCH_FIXED_JD_UNIX_EPOCH + ((int64_t)timestamp * 625) / 54;
+}
+
+uint32_t watch_fixed_unix_time_from_julian_date(int64_t julian_date) {
+    // julian_date_from_unix_time drops up to 53/54 of a millionth of a day; adding it back makes round trips exact.
+    return (uint32_t)(((julian_date - WATCH_FIXED_JD_UNIX_EPOCH) * 54 + 53) / 625);
+}
@@ -0,0 +1,110 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2024 Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef _WATCH_FIXED_MATH_H_INCLUDED
+#define _WATCH_FIXED_MATH_H_INCLUDED
+////< @file watch_fixed_math.h
+
+#include <stdint.h>
+
+/** @addtogroup fixed_math Fixed-Point Math
+  * @brief This section covers integer-only replacements for the handful of libm functions that watch faces
+  *        tend to call on every tick. The SAM L22 has no FPU, so every double operation is a soft-float library
+  *        call, and pulling in fmod, cos or log links several kilobytes of code. These functions use small
+  *        lookup tables instead and are accurate to roughly four decimal places, which is plenty for a display
+  *        with six digits.
+  *
+  *        Conventions:
+  *         - Angles are binary angles: a uint16_t where 65536 is one full turn (so 16384 is 90 degrees).
+  *         - Trig results are Q15: 32767 represents 1.0.
+  *         - Q16 values have 16 fractional bits: 65536 represents 1.0.
+  *         - Julian dates are int64_t counts of millionths of a day (about 86 ms of resolution).
+  **/
+/// @{
+
+#define WATCH_FIXED_Q16_ONE 65536
+#define WATCH_FIXED_Q15_ONE 32767
+
+/// The Julian date of the Unix epoch, 1970-01-01 00:00 UTC, in millionths of a day.
+#define WATCH_FIXED_JD_UNIX_EPOCH 2440587500000LL
+/// The Julian date of J2000.0, 2000-01-01 12:00 TT, in millionths of a day.
+#define WATCH_FIXED_JD_J2000 2451545000000LL
+
+/** @brief Like fmod, but the result always has the sign of the divisor, so that it can be used to wrap
+  *        angles and times of day into [0, y).
+  * @param x The dividend, in any fixed-point format.
+  * @param y The divisor, in the same format as x. Must be positive.
+  */
+int32_t watch_fixed_wrap(int32_t x, int32_t y);
+
+/// @brief The same as watch_fixed_wrap, for 64-bit values like Julian dates.
+int64_t watch_fixed_wrap64(int64_t x, int64_t y);
+
+/** @brief Converts an angle in hundredths of a degree to a binary angle.
+  * @param centidegrees The angle, which may be negative or larger than one turn.
+  */
+uint16_t watch_fixed_angle_from_centidegrees(int32_t centidegrees);
+
+/** @brief Returns the sine of a binary angle in Q15.
+  * @param angle The angle, where 65536 is one full turn.
+  */
+int16_t watch_fixed_sin(uint16_t angle);
+
+/** @brief Returns the cosine of a binary angle in Q15.
+  * @param angle The angle, where 65536 is one full turn.
+  */
+int16_t watch_fixed_cos(uint16_t angle);
+
+/** @brief Returns the base 2 logarithm of a Q16 value, in Q16.
+  * @param x The value whose logarithm you want. Must be greater than zero; returns INT32_MIN otherwise.
+  */
+int32_t watch_fixed_log2(uint32_t x);
+
+/** @brief Returns the natural logarithm of a Q16 value, in Q16.
+  * @param x The value whose logarithm you want. Must be greater than zero; returns INT32_MIN otherwise.
+  */
+int32_t watch_fixed_log(uint32_t x);
+
+/** @brief Returns the Julian day number (the Julian date at noon) for a date in the Gregorian calendar.
+  * @param year The year of the date (ex. 2024)
+  * @param month The month of the date (1-12)
+  * @param day The day of the date (1-31)
+  */
+int32_t watch_fixed_julian_day_number(uint16_t year, uint8_t month, uint8_t day);
+
+/** @brief Converts a UNIX timestamp to a Julian date in millionths of a day.
+  * @param timestamp The UNIX timestamp, in UTC.
+  */
+int64_t watch_fixed_julian_date_from_unix_time(uint32_t timestamp);
+
+/** @brief Converts a Julian date in millionths of a day to a UNIX timestamp.
+  * @details The result is rounded down to the second, but only after adding just under one millionth of a
+  *          day (about 85 ms). watch_fixed_julian_date_from_unix_time rounds down too, and this makes up for
+  *          it, so that a timestamp converted to a Julian date and back comes out the same.
+  * @param julian_date The Julian date. Must be on or after the UNIX epoch.
+  */
+uint32_t watch_fixed_unix_time_from_julian_date(int64_t julian_date);
+
+/// @}
+#endif
@@ -41,10 +41,9 @@
   */
 /// @{
 /** @brief Enables the bi-color LED.
-  * @note The TCC peripheral that drives the LEDs does not run in STANDBY mode — but the outputs do! This
-  *       means that if you set either red, green or both LEDs to full power, they will shine even when
-  *       your app is asleep. If, however, you set a custom color using watch_set_led_color, the color will
-  *       not display correctly in STANDBY mode. You will need to keep your app running while the LED is on.
+  * @note While the LED is lit, the TCC peripheral that drives it keeps running in STANDBY mode, along with the
+  *       main oscillator it runs from, so any color displays correctly while your app is asleep. That costs a
+  *       little current on top of standby, though much less than the LED itself draws.
   */
 void watch_enable_leds(void);
 
@@ -57,9 +56,7 @@ void watch_disable_leds(void);
 /** @brief Sets the LED to a custom color by modulating each output's duty cycle.
   * @param red The red value from 0-255.
   * @param green The green value from 0-255. If your watch has a red/blue LED, this will be the blue value.
-  * @note If you are displaying a custom color, you will need to prevent your app from going to sleep
-  *       while the LED is on; otherwise, the color will not display correctly. You can do this by
-  *       returning false in your app_loop method.
+  * @note This stops any fade or blink that is running.
   */
 void watch_set_led_color(uint8_t red, uint8_t green);
 
@@ -67,9 +64,7 @@ void watch_set_led_color(uint8_t red, uint8_t green);
   * @param red The red value from 0-255.
   * @param green The green value from 0-255.
   * @param blue The blue value from 0-255.
-  * @note If you are displaying a custom color, you will need to prevent your app from going to sleep
-  *       while the LED is on; otherwise, the color will not display correctly. You can do this by
-  *       returning false in your app_loop method.
+  * @note This stops any fade or blink that is running.
   */
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue);
 
@@ -94,6 +89,44 @@ void watch_set_led_yellow(void);
 /** @brief Turns both the red and the green LEDs off. */
 void watch_set_led_off(void);
 
+/** @brief Fades the LED from whatever it shows now to a new color, while your app sleeps.
+  * @details A timer steps through the fade and DMA loads each step into the TCC, so the CPU doesn't have to stay
+  *          awake for it. The brightness follows a curve that looks even to the eye. Setting a color, or starting
+  *          another fade or a blink, stops this one where it is, without calling its callback.
+  * @param red The red value from 0-255.
+  * @param green The green value from 0-255. If your watch has a red/blue LED, this will be the blue value.
+  * @param duration_ms How long the fade takes. Zero sets the color right away.
+  * @param callback_on_end A function to call, from an interrupt, when the fade is done; or NULL.
+  */
+void watch_led_fade_to_color(uint8_t red, uint8_t green, uint16_t duration_ms, void (*callback_on_end)(void));
+
+/** @brief On boards with an RGB LED, fades the LED to a new color, like watch_led_fade_to_color.
+  * @param red The red value from 0-255.
+  * @param green The green value from 0-255.
+  * @param blue The blue value from 0-255.
+  * @param duration_ms How long the fade takes. Zero sets the color right away.
+  * @param callback_on_end A function to call, from an interrupt, when the fade is done; or NULL.
+  */
+void watch_led_fade_to_color_rgb(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, void (*callback_on_end)(void));
+
+/** @brief Blinks the LED in a color, on for interval_ms and then off for as long, until you set a color or start
+  *        a fade. Like a fade, this runs while your app sleeps.
+  * @param red The red value from 0-255.
+  * @param green The green value from 0-255. If your watch has a red/blue LED, this will be the blue value.
+  * @param interval_ms How long the LED stays on, and then off.
+  */
+void watch_led_blink(uint8_t red, uint8_t green, uint16_t interval_ms);
+
+/** @brief Calls a function once, after a delay, from a timer that runs while your app sleeps. This is for turning
+  *        the LED off after a while; there is only one such timer, and setting it again replaces the last one.
+  * @param delay_ms How long to wait, up to a minute or so.
+  * @param callback The function to call, from an interrupt.
+  */
+void watch_led_set_timeout(uint16_t delay_ms, void (*callback)(void));
+
+/** @brief Cancels the timeout set with watch_led_set_timeout, if it hasn't gone off yet. */
+void watch_led_clear_timeout(void);
+
 /** @brief Activates led digital input for reading. */
 void watch_set_led_in(void);
 
@@ -38,19 +38,56 @@ void _watch_enable_tcc(void);
 /// Called by buzzer and LED teardown functions. You should not call this from your app.
 void _watch_disable_tcc(void);
 
-/// Enable USB task timer. Called by USB enable routine in main(). You should not call this from your app.
-void _watch_enable_tc0(void);
+/// Users of TCC0 that need it to keep running in standby.
+#define WATCH_TCC_STANDBY_BUZZER 0x01
+#define WATCH_TCC_STANDBY_LED 0x02
 
-/// Disable USB task timer. You should not call this from your app.
-void _watch_disable_tc0(void);
+/// Keeps TCC0 (and the main clock it runs from) going in standby while any of its users need it. Called by the
+/// buzzer and LED drivers. You should not call this from your app.
+void _watch_tcc_run_in_standby(uint8_t user, bool run);
 
-/// Enable CDC task timer. Called by USB enable routine in main(). You should not call this from your app.
-void _watch_enable_tc1(void);
+/// Returns the TCC prescaler value that divides the current main clock down to 1 MHz. You should not call this from your app.
+uint8_t _watch_get_tcc_prescaler(void);
 
-/// Disable CDC task timer. You should not call this from your app.
-void _watch_disable_tc1(void);
+/// Starts the timer that main.c uses to measure how long each stage of boot takes. You should not call this from your app.
+void _watch_enable_boot_timer(void);
+
+/// Stops the boot timer and releases its hardware, TC0 and TC1. Called by main.c once boot is done, and by the LED
+/// driver if it needs them sooner. You should not call this from your app.
+void _watch_disable_boot_timer(void);
 
 /// Called by main.c if plugged in to USB. You should not call this from your app.
 void _watch_enable_usb(void);
 
+#ifndef __EMSCRIPTEN__
+
+/// DMA channels used by the watch library. Each driver that uses DMA gets its own channel. Only channels 0-3 can be
+/// triggered by an event, so those go to drivers that need that.
+#define WATCH_DMA_CHANNEL_BUZZER_PERIOD 0
+#define WATCH_DMA_CHANNEL_BUZZER_DUTY 1
+#define WATCH_DMA_CHANNEL_BUZZER_DURATION 2
+#define WATCH_DMA_CHANNEL_SPI_RX 4
+#define WATCH_DMA_CHANNEL_SPI_TX 5
+#define WATCH_DMA_CHANNEL_LED_RED 6
+#define WATCH_DMA_CHANNEL_LED_GREEN 7
+#define WATCH_DMA_CHANNEL_LED_BLUE 8
+#define WATCH_DMA_NUM_CHANNELS 9
+
+/// Event system channels used by the watch library.
+#define WATCH_EVSYS_CHANNEL_BUZZER 0
+
+/// Turns on the DMA controller if need be, and returns a DMA channel's transfer descriptor for the caller to fill in.
+/// The caller sets up the channel itself. You should not call this from your app.
+DmacDescriptor *_watch_dma_get_descriptor(uint8_t channel);
+
+/// Sets a function for the DMAC interrupt to call when a channel with its TCMPL interrupt enabled finishes a
+/// transfer; NULL for none. You should not call this from your app.
+void _watch_dma_set_callback(uint8_t channel, void (*callback)(void));
+
+/// Disables a DMA channel, waits for it to stop, and clears its interrupt flags. The caller masks interrupts if the
+/// DMAC interrupt could select another channel in the meantime. You should not call this from your app.
+void _watch_dma_stop_channel(uint8_t channel);
+
+#endif
+
 #endif
@@ -28,4 +28,55 @@
 // i.e. for a 440 Hz tone (A4 on the piano), 1MHz/440Hz = 2273
 const uint16_t NotePeriods[108] = {18182,17161,16197,15288,14430,13620,12857,12134,11453,10811,10204,9631,9091,8581,8099,7645,7216,6811,6428,6068,5727,5405,5102,4816,4545,4290,4050,3822,3608,3405,3214,3034,2863,2703,2551,2408,2273,2145,2025,1911,1804,1703,1607,1517,1432,1351,1276,1204,1136,1073,1012,956,902,851,804,758,716,676,638,602,568,536,506,478,451,426,402,379,358,338,319,301,284,268,253,239,225,213,201,190,179,169,159,150,142,134,127};
 
+// a compressed tune being played; watch_buzzer_play_tune in watch_buzzer.h describes the format.
+typedef struct {
+    const uint8_t *position;
+    const uint8_t *durations;
+    uint8_t pitch;
+} watch_buzzer_tune_reader_t;
+
+static void _watch_buzzer_tune_start(watch_buzzer_tune_reader_t *reader, const uint8_t *tune) {
+    reader->durations = tune + 1;
+    reader->position = tune + 1 + tune[0];
+    reader->pitch = BUZZER_NOTE_A4;
+}
+
+/// @brief Decodes the next note of a compressed tune.
+/// @return false at the end of the tune.
+static bool _watch_buzzer_tune_next(watch_buzzer_tune_reader_t *reader, BuzzerNote *note, uint16_t *ticks) {
+    uint8_t head = *reader->position;
+    if (!head) return false;
+    reader->position++;
+
+    int16_t value;
+    switch (head >> 3) {
+        case 0:
+            value = BUZZER_NOTE_REST;
+            break;
+        case 31:
+            value = *reader->position++;
+            break;
+        default:
+            value = reader->pitch + (head >> 3) - 16;
+            break;
+    }
+    // a bad tune ends here, rather than reading a period from past the end of NotePeriods.
+    if (value < 0 || value > BUZZER_NOTE_REST) return false;
+    *note = value;
+    if (value != BUZZER_NOTE_REST) reader->pitch = value;
+
+    if (head & 7) {
+        *ticks = reader->durations[(head & 7) - 1];
+    } else {
+        uint8_t byte, shift = 0;
+        *ticks = 0;
+        do {
+            byte = *reader->position++;
+            *ticks |= (uint16_t)(byte & 0x7F) << shift;
+            shift += 7;
+        } while (byte & 0x80);
+    }
+    return true;
+}
+
 #endif
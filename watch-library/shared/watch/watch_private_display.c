@@ -22,6 +22,7 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_slcd.h"
 #include "watch_private_display.h"
 
@@ -33,7 +34,28 @@ static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
 };
 
+// what was last written to each position, as the caller asked for it (before the substitutions below).
+static char displayed_characters[] = "          ";
+
+void _watch_display_clear_characters(void) {
+    memset(displayed_characters, ' ', Num_Chars);
+}
+
+void watch_get_display_string(char *buffer) {
+    memcpy(buffer, displayed_characters, Num_Chars + 1);
+}
+
+bool watch_get_indicator(WatchIndicatorSegment indicator) {
+    uint32_t value = IndicatorSegments[indicator];
+    return watch_get_pixel(SLCD_COMNUM(value), SLCD_SEGNUM(value));
+}
+
+bool watch_get_colon(void) {
+    return watch_get_pixel(1, 16);
+}
+
 void watch_display_character(uint8_t character, uint8_t position) {
+    displayed_characters[position] = character;
     // special cases for positions 4 and 6
     if (position == 4 || position == 6) {
         if (character == '7') character = '&'; // "lowercase" 7
@@ -101,6 +123,7 @@ void watch_display_character(uint8_t character, uint8_t position) {
 
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
     // Will only work for digits and for positions  8 and 9 - but less code & checks to reduce power consumption
+    displayed_characters[position] = character;
 
     uint64_t segmap = Segment_Map[position];
     uint64_t segdata = Character_Set[character - 0x20];
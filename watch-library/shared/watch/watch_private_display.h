@@ -144,5 +144,8 @@ static const uint8_t Num_Chars = 10;
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
 
+// watch_clear_display calls this, so that watch_get_display_string knows the positions are blank.
+void _watch_display_clear_characters(void);
+
 
 #endif
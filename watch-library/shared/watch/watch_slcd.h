@@ -69,6 +69,13 @@ void watch_set_pixel(uint8_t com, uint8_t seg);
   */
 void watch_clear_pixel(uint8_t com, uint8_t seg);
 
+/** @brief Checks whether a pixel is on.
+  * @param com the common pin, numbered from 0-2.
+  * @param seg the segment pin, numbered from 0-23.
+  * @return true if the pixel is set; false otherwise.
+  */
+bool watch_get_pixel(uint8_t com, uint8_t seg);
+
 /** @brief Clears all segments of the display, including incicators and the colon.
   */
 void watch_clear_display(void);
@@ -84,6 +91,15 @@ void watch_clear_display(void);
   */
 void watch_display_string(char *string, uint8_t position);
 
+/** @brief Reads back what is on the display, for test scripts and the shell's display command.
+  * @param buffer A buffer of at least 11 bytes, which receives the ten characters most recently displayed
+  *               at each position (with a space for any position cleared by watch_clear_display) and a
+  *               terminating null.
+  * @note These are the characters as they were passed to watch_display_string, before any substitutions
+  *       for positions that can't show them. Segments set directly with watch_set_pixel aren't included.
+  */
+void watch_get_display_string(char *buffer);
+
 /** @brief Turns the colon segment on.
   */
 void watch_set_colon(void);
@@ -102,6 +118,16 @@ void watch_set_indicator(WatchIndicatorSegment indicator);
   */
 void watch_clear_indicator(WatchIndicatorSegment indicator);
 
+/** @brief Checks whether an indicator is on.
+  * @param indicator One of the indicator segments from the enum. @see WatchIndicatorSegment
+  * @return true if the indicator is set; false otherwise.
+  */
+bool watch_get_indicator(WatchIndicatorSegment indicator);
+
+/** @brief Checks whether the colon segment is on.
+  */
+bool watch_get_colon(void);
+
 /** @brief Clears all indicator segments.
   * @see WatchIndicatorSegment
   */
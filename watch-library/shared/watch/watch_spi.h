@@ -41,6 +41,11 @@ void watch_enable_spi(void);
   */
 void watch_disable_spi(void);
 
+/** @brief Returns true if the SPI peripheral is enabled. Code that borrows the bus for a moment can check this
+  *        first, and leave SPI enabled afterwards for whoever enabled it.
+  */
+bool watch_is_spi_enabled(void);
+
 /** @brief Writes a series of values to a device on the SPI bus.
   * @param buf A series of unsigned bytes; the data you wish to transmit.
   * @param length The number of bytes in buf that you wish to send.
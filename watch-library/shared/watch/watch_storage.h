@@ -52,6 +52,9 @@
   *          in this area. The region is laid out as 32 rows consisting of 4 pages of 64 bytes.
   *          32*4*64 = 8192 bytes. The area can be written one page at a time, but it can only be
   *          erased one row at a time. You can read at arbitrary word-aligned offsets within a row.
+  *          Erases and writes happen in the background: watch_storage_write and watch_storage_erase
+  *          return once the operation has started, and the next call waits (asleep) for it to finish.
+  *          If you'd rather not wait at all, use the _async variants and pass a callback.
   *
   *                 ┌──────────────┬──────────────┬──────────────┬──────────────┐
   *          Row 0  │   64 bytes   │   64 bytes   │   64 bytes   │   64 bytes   │
@@ -85,8 +88,32 @@ bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, u
   */
 bool watch_storage_erase(uint32_t row);
 
-/** @brief Waits for any pending writes to complete.
+/** @brief Waits for any pending writes to complete. The CPU sleeps while it waits, and wakes when the
+  *        flash controller signals that it's ready.
   */
 bool watch_storage_sync(void);
+
+/** @brief Starts writing a page without waiting for the write to finish.
+  * @param row The row containing the page you want to write.
+  * @param offset The offset from the beginning of the row. Must be a multiple of 64.
+  * @param buffer The buffer containing the bytes you wish to set. It's copied before this function returns.
+  * @param size The number of bytes you wish to write.
+  * @param callback A function to call (from an interrupt) once the write is done, or NULL.
+  * @return true if the write was started; false if the address was invalid, or the flash controller is
+  *         still busy with another operation.
+  */
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, void (*callback)(void));
+
+/** @brief Starts erasing a row without waiting for the erase to finish.
+  * @param row The row you want to erase.
+  * @param callback A function to call (from an interrupt) once the erase is done, or NULL.
+  * @return true if the erase was started; false if the row was invalid, or the flash controller is
+  *         still busy with another operation.
+  */
+bool watch_storage_erase_async(uint32_t row, void (*callback)(void));
+
+/** @brief Returns true if an erase or write is still in progress.
+  */
+bool watch_storage_is_busy(void);
 /// @}
 #endif
@@ -22,8 +22,8 @@
  * SOFTWARE.
  */
 
-#include <math.h>
 #include "watch_utility.h"
+#include "watch_fixed_math.h"
 
 const char * watch_utility_get_weekday(watch_date_time date_time) {
     static const char weekdays[7][3] = {"MO", "TU", "WE", "TH", "FR", "SA", "SU"};
@@ -289,23 +289,38 @@ bool watch_utility_convert_to_12_hour(watch_date_time *date_time) {
 }
 
 float watch_utility_thermistor_temperature(uint16_t value, bool highside, float b_coefficient, float nominal_temperature, float nominal_resistance, float series_resistance) {
-    float reading = (float)value;
-
+    // All of the parameters are constants in practice, so converting them is cheap; everything after that is
+    // integer math, which keeps double-precision log() out of the firmware.
+    uint32_t b = (uint32_t)b_coefficient;
+    uint32_t r_nominal = (uint32_t)nominal_resistance;
+    uint32_t r_series = (uint32_t)series_resistance;
+    int64_t nominal_centikelvin = (int32_t)(nominal_temperature * 100) + 27315;
+    uint64_t numerator;
+    uint64_t denominator;
+
+    // The ratio of the thermistor's resistance to its nominal resistance, as a fraction.
     if (highside) {
-        reading = (1023.0 * series_resistance) / (reading / 64.0);
-        reading -= series_resistance;
+        // R = series * (1023 / (value / 64) - 1)
+        if (value >= 65472) return -273.15f;
+        numerator = (uint64_t)r_series * (65472 - value);
+        denominator = (uint64_t)value * r_nominal;
     } else {
-        reading = series_resistance / (65535.0 / value - 1.0);
+        // R = series / (65535 / value - 1)
+        numerator = (uint64_t)r_series * value;
+        denominator = (uint64_t)(65535 - value) * r_nominal;
     }
+    if (numerator == 0 || denominator == 0) return -273.15f;
+
+    uint64_t ratio = (numerator << 16) / denominator;
+    if (ratio > UINT32_MAX) ratio = UINT32_MAX;
+
+    // 1/T = 1/T0 + ln(R/R0)/B, with 1/T in units of 2^-32 per kelvin
+    int64_t inverse_temperature = (int64_t)watch_fixed_log(ratio) * 65536 / b + ((int64_t)100 << 32) / nominal_centikelvin;
+    if (inverse_temperature <= 0) return -273.15f;
 
-    reading = reading / nominal_resistance;
-    reading = log(reading);
-    reading /= b_coefficient;
-    reading += 1.0 / (nominal_temperature + 273.15);
-    reading = 1.0 / reading;
-    reading -= 273.15;
+    int32_t centikelvin = ((int64_t)100 << 32) / inverse_temperature;
 
-    return reading;
+    return (centikelvin - 27315) / 100.0f;
 }
 
 uint32_t watch_utility_offset_timestamp(uint32_t now, int8_t hours, int8_t minutes, int8_t seconds) {
@@ -105,10 +105,30 @@ void delay_ms(const uint16_t ms) {
     main_loop_sleep(ms);
 }
 
+static watch_boot_times_t boot_times;
+
+const watch_boot_times_t *watch_get_boot_times(void) {
+    return &boot_times;
+}
+
 int main(void) {
+    uint32_t stage_start;
+
+    _watch_enable_boot_timer();
+
+    stage_start = watch_get_boot_timer_us();
     app_init();
+    boot_times.app_init = watch_get_boot_timer_us() - stage_start;
+
+    stage_start = watch_get_boot_timer_us();
     _watch_init();
+    boot_times.rtc = watch_get_boot_timer_us() - stage_start;
+
+    stage_start = watch_get_boot_timer_us();
     app_setup();
+    boot_times.app_setup = watch_get_boot_timer_us() - stage_start;
+
+    _watch_disable_boot_timer();
 
     resume_main_loop();
 
@@ -1,3 +1,4 @@
+#include <emscripten.h>
 #include "watch.h"
 
 bool watch_is_buzzer_or_led_enabled(void) {
@@ -8,6 +9,33 @@ bool watch_is_usb_enabled(void) {
     return true;
 }
 
+static watch_cpu_speed_t cpu_speed = WATCH_CPU_SPEED_4_MHZ;
+
+void watch_set_cpu_speed(watch_cpu_speed_t speed) {
+    // the simulator runs as fast as the browser lets it; just remember what was asked for.
+    cpu_speed = speed;
+}
+
+watch_cpu_speed_t watch_get_cpu_speed(void) {
+    return cpu_speed;
+}
+
+static double cycle_timer_start;
+
+void watch_cycle_timer_start(void) {
+    cycle_timer_start = emscripten_get_now();
+}
+
+uint32_t watch_cycle_timer_get_us(void) {
+    return (uint32_t)((emscripten_get_now() - cycle_timer_start) * 1000);
+}
+
+const watch_cdc_stats_t *watch_get_cdc_stats(void) {
+    // output goes straight to the browser console, and never gets dropped.
+    static const watch_cdc_stats_t stats = {0};
+    return &stats;
+}
+
 void watch_reset_to_bootloader(void) {
     // No bootloader in the simulator; nothing to do here
 }
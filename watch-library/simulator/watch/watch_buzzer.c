@@ -35,9 +35,17 @@ static uint32_t buzzer_period;
 void cb_watch_buzzer_seq(void *userData);
 
 static uint16_t _seq_position;
-static int8_t _tone_ticks, _repeat_counter;
+static uint16_t _tone_ticks;
+static int8_t _repeat_counter;
 static long _em_interval_id = 0;
+// the note/duration sequence being played, or NULL when it's a compressed tune or notes.
 static int8_t *_sequence;
+static watch_buzzer_tune_reader_t _tune;
+// the notes being played, and how many are left, or NULL.
+static const watch_buzzer_note_t *_notes;
+static uint8_t _notes_left;
+// watch_buzzer_play_note_async's note, which the caller doesn't have to keep.
+static watch_buzzer_note_t _single_note;
 static void (*_cb_finished)(void);
 
 static inline void _em_interval_stop() {
@@ -45,54 +53,103 @@ static inline void _em_interval_stop() {
     _em_interval_id = 0;
 }
 
-void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
-    if (_em_interval_id) _em_interval_stop();
-    watch_set_buzzer_off();
-    _sequence = note_sequence;
+static void _seq_play(void (*callback_on_end)(void)) {
     _cb_finished = callback_on_end;
-    _seq_position = 0;
     _tone_ticks = 0;
-    _repeat_counter = -1;
     // prepare buzzer
     watch_enable_buzzer();
     // initiate 64 hz callback
     _em_interval_id = emscripten_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL);
 }
 
+void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
+    if (_em_interval_id) _em_interval_stop();
+    watch_set_buzzer_off();
+    _sequence = note_sequence;
+    _notes = NULL;
+    _seq_position = 0;
+    _repeat_counter = -1;
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_tune(const uint8_t *tune, void (*callback_on_end)(void)) {
+    if (_em_interval_id) _em_interval_stop();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _notes = NULL;
+    _watch_buzzer_tune_start(&_tune, tune);
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_notes(const watch_buzzer_note_t *notes, uint8_t count, void (*callback_on_end)(void)) {
+    if (_em_interval_id) _em_interval_stop();
+    watch_set_buzzer_off();
+    _sequence = NULL;
+    _notes = notes;
+    _notes_left = count;
+    _seq_play(callback_on_end);
+}
+
+void watch_buzzer_play_note_async(BuzzerNote note, uint16_t duration_ms, void (*callback_on_end)(void)) {
+    _single_note.note = note;
+    _single_note.duration_ms = duration_ms;
+    watch_buzzer_play_notes(&_single_note, 1, callback_on_end);
+}
+
+/// @brief Reads the next note from the sequence, following any repeat marker, or from the tune or notes.
+/// @return false at the end of the sequence.
+static bool _seq_next_note(BuzzerNote *note, uint16_t *ticks) {
+    if (_notes) {
+        if (!_notes_left) return false;
+        *note = _notes->note;
+        // a note lasts one tick more than this, and a tick is a 64th of a second.
+        uint32_t played = ((uint32_t)_notes->duration_ms * 64 + 500) / 1000;
+        *ticks = played ? played - 1 : 0;
+        _notes++;
+        _notes_left--;
+        return true;
+    }
+    if (!_sequence) return _watch_buzzer_tune_next(&_tune, note, ticks);
+    if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
+        // repeat indicator found
+        if (_repeat_counter == -1) {
+            // first encounter: load repeat counter
+            _repeat_counter = _sequence[_seq_position + 1];
+        } else _repeat_counter--;
+        if (_repeat_counter > 0)
+            // rewind
+            if (_seq_position > _sequence[_seq_position] * -2)
+                _seq_position += _sequence[_seq_position] * 2;
+            else
+                _seq_position = 0;
+        else {
+            // continue
+            _seq_position += 2;
+            _repeat_counter = -1;
+        }
+    }
+    if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
+        *note = _sequence[_seq_position];
+        *ticks = _sequence[_seq_position + 1];
+        _seq_position += 2;
+        return true;
+    }
+    return false;
+}
+
 void cb_watch_buzzer_seq(void *userData) {
     // callback for reading the note sequence
     (void) userData;
     if (_tone_ticks == 0) {
-        if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
-            // repeat indicator found
-            if (_repeat_counter == -1) {
-                // first encounter: load repeat counter
-                _repeat_counter = _sequence[_seq_position + 1];
-            } else _repeat_counter--;
-            if (_repeat_counter > 0)
-                // rewind
-                if (_seq_position > _sequence[_seq_position] * -2)
-                    _seq_position += _sequence[_seq_position] * 2;
-                else
-                    _seq_position = 0;
-            else {
-                // continue
-                _seq_position += 2;
-                _repeat_counter = -1;
-            }
-        }
-        if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
-            // read note
-            BuzzerNote note = _sequence[_seq_position];
+        BuzzerNote note;
+        if (_seq_next_note(&note, &_tone_ticks)) {
+            // play note
             if (note == BUZZER_NOTE_REST) {
                 watch_set_buzzer_off();
             } else {
                 watch_set_buzzer_period(NotePeriods[note]);
                 watch_set_buzzer_on();
             }
-            // set duration ticks and move to next tone
-            _tone_ticks = _sequence[_seq_position + 1];
-            _seq_position += 2;
         } else {
             // end the sequence
             watch_buzzer_abort_sequence();
@@ -107,6 +164,10 @@ void watch_buzzer_abort_sequence(void) {
     watch_set_buzzer_off();
 }
 
+void watch_buzzer_wait_for_sequence(void) {
+    // the sequence plays from a browser timer, which can't fire while we block.
+}
+
 void watch_enable_buzzer(void) {
     buzzer_enabled = true;
     buzzer_period = NotePeriods[BUZZER_NOTE_A4];
@@ -23,14 +23,30 @@
  */
 
 #include "watch_led.h"
+#include "watch_main_loop.h"
 
 #include <emscripten.h>
+#include <emscripten/html5.h>
+#include <math.h>
 
-void watch_enable_leds(void) {}
+// fades and blinks step from a browser timer; a fade takes as many steps as it does on the watch.
+#define WATCH_LED_FADE_STEPS 64
 
-void watch_disable_leds(void) {}
+static uint8_t _led_red;
+static uint8_t _led_green;
+static long _em_interval_id = 0;
+static long _em_timeout_id = 0;
+static uint8_t _from[2];
+static uint8_t _to[2];
+static uint8_t _steps;
+static uint8_t _step;
+static bool _blink;
+static void (*_cb_finished)(void);
+static void (*_cb_timeout)(void);
 
-void watch_set_led_color(uint8_t red, uint8_t green) {
+static void _led_show(uint8_t red, uint8_t green) {
+    _led_red = red;
+    _led_green = green;
     EM_ASM({
         // the watch svg contains an feColorMatrix filter with id ledcolor
         // and a green svg gradient that mimics the led being on
@@ -44,6 +60,55 @@ void watch_set_led_color(uint8_t red, uint8_t green) {
     }, red, green);
 }
 
+static void _led_stop_animation(void) {
+    if (_em_interval_id) {
+        emscripten_clear_interval(_em_interval_id);
+        _em_interval_id = 0;
+    }
+}
+
+static uint8_t _led_step_value(uint8_t from, uint8_t to) {
+    // the same curve as the watch: even steps in the square root of the brightness.
+    double root = sqrt(from) + (sqrt(to) - sqrt(from)) * _step / _steps;
+    return (uint8_t)(root * root + 0.5);
+}
+
+static void cb_watch_led_step(void *userData) {
+    (void) userData;
+    if (_blink) {
+        _step = !_step;
+        _led_show(_step ? 0 : _to[0], _step ? 0 : _to[1]);
+        return;
+    }
+    _step++;
+    _led_show(_led_step_value(_from[0], _to[0]), _led_step_value(_from[1], _to[1]));
+    if (_step == _steps) {
+        _led_stop_animation();
+        if (_cb_finished) _cb_finished();
+        resume_main_loop();
+    }
+}
+
+static void cb_watch_led_timeout(void *userData) {
+    (void) userData;
+    void (*callback)(void) = _cb_timeout;
+    _em_timeout_id = 0;
+    _cb_timeout = NULL;
+    if (callback) callback();
+    resume_main_loop();
+}
+
+void watch_enable_leds(void) {}
+
+void watch_disable_leds(void) {
+    _led_stop_animation();
+}
+
+void watch_set_led_color(uint8_t red, uint8_t green) {
+    _led_stop_animation();
+    _led_show(red, green);
+}
+
 void watch_set_led_color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
     (void) blue;
     watch_set_led_color(red, green);
@@ -65,6 +130,52 @@ void watch_set_led_off(void) {
     watch_set_led_color(0, 0);
 }
 
+void watch_led_fade_to_color(uint8_t red, uint8_t green, uint16_t duration_ms, void (*callback_on_end)(void)) {
+    uint32_t steps = duration_ms * 64 / 1000;
+    if (steps == 0) {
+        watch_set_led_color(red, green);
+        if (callback_on_end) callback_on_end();
+        return;
+    }
+    _led_stop_animation();
+    _from[0] = _led_red;
+    _from[1] = _led_green;
+    _to[0] = red;
+    _to[1] = green;
+    _steps = steps < WATCH_LED_FADE_STEPS ? steps : WATCH_LED_FADE_STEPS;
+    _step = 0;
+    _blink = false;
+    _cb_finished = callback_on_end;
+    _em_interval_id = emscripten_set_interval(cb_watch_led_step, (double)duration_ms / _steps, NULL);
+}
+
+void watch_led_fade_to_color_rgb(uint8_t red, uint8_t green, uint8_t blue, uint16_t duration_ms, void (*callback_on_end)(void)) {
+    (void) blue;
+    watch_led_fade_to_color(red, green, duration_ms, callback_on_end);
+}
+
+void watch_led_blink(uint8_t red, uint8_t green, uint16_t interval_ms) {
+    watch_set_led_color(red, green);
+    if (interval_ms == 0) return;
+    _to[0] = red;
+    _to[1] = green;
+    _step = 0;
+    _blink = true;
+    _em_interval_id = emscripten_set_interval(cb_watch_led_step, interval_ms, NULL);
+}
+
+void watch_led_set_timeout(uint16_t delay_ms, void (*callback)(void)) {
+    watch_led_clear_timeout();
+    _cb_timeout = callback;
+    _em_timeout_id = emscripten_set_timeout(cb_watch_led_timeout, delay_ms, NULL);
+}
+
+void watch_led_clear_timeout(void) {
+    if (_em_timeout_id) emscripten_clear_timeout(_em_timeout_id);
+    _em_timeout_id = 0;
+    _cb_timeout = NULL;
+}
+
 void watch_set_led_in(void) { }
 
 void watch_set_led_out(void) { }
@@ -25,6 +25,7 @@
 #include "watch_private.h"
 #include "watch_utility.h"
 #include <sys/time.h>
+#include <emscripten.h>
 
 void _watch_init(void) {
     // External wake depends on RTC; calendar is a required module.
@@ -51,10 +52,30 @@ int _gettimeofday(struct timeval *tv, void *tzvp) {
     return 0;
 }
 
+static double _boot_timer_start = -1;
+
+void _watch_enable_boot_timer(void) {
+    _boot_timer_start = emscripten_get_now();
+}
+
+uint32_t watch_get_boot_timer_us(void) {
+    if (_boot_timer_start < 0) return 0;
+    return (uint32_t)((emscripten_get_now() - _boot_timer_start) * 1000);
+}
+
+void _watch_disable_boot_timer(void) {
+    _boot_timer_start = -1;
+}
+
 void _watch_enable_tcc(void) {}
 
 void _watch_disable_tcc(void) {}
 
+void _watch_tcc_run_in_standby(uint8_t user, bool run) {
+    (void) user;
+    (void) run;
+}
+
 void _watch_enable_usb(void) {}
 
 void watch_disable_TRNG() {}
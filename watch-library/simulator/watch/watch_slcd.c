@@ -56,11 +56,19 @@ void watch_clear_pixel(uint8_t com, uint8_t seg) {
     }, com, seg);
 }
 
+bool watch_get_pixel(uint8_t com, uint8_t seg) {
+    return EM_ASM_INT({
+        const e = document.querySelector("[data-com='" + $0 + "'][data-seg='" + $1 + "']");
+        return e && e.style.opacity == 1;
+    }, com, seg);
+}
+
 void watch_clear_display(void) {
     EM_ASM({
         document.querySelectorAll("[data-com][data-seg]")
             .forEach((e) => e.style.opacity = 0);
     });
+    _watch_display_clear_characters();
 }
 
 static void watch_invoke_blink_callback(void *userData) {
@@ -24,9 +24,13 @@
 
 #include "watch_spi.h"
 
-void watch_enable_spi(void) {}
+static bool spi_enabled = false;
 
-void watch_disable_spi(void) {}
+void watch_enable_spi(void) { spi_enabled = true; }
+
+void watch_disable_spi(void) { spi_enabled = false; }
+
+bool watch_is_spi_enabled(void) { return spi_enabled; }
 
 bool watch_spi_write(const uint8_t *buf, uint16_t length) { return false; }
 
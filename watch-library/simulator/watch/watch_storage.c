@@ -30,3 +30,22 @@ bool watch_storage_sync(void) {
     // nothing to do here!
     return true;
 }
+
+bool watch_storage_write_async(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size, void (*callback)(void)) {
+    // writes in the simulator are instant, so we can finish right away.
+    bool success = watch_storage_write(row, offset, buffer, size);
+    if (success && callback != NULL) callback();
+
+    return success;
+}
+
+bool watch_storage_erase_async(uint32_t row, void (*callback)(void)) {
+    bool success = watch_storage_erase(row);
+    if (success && callback != NULL) callback();
+
+    return success;
+}
+
+bool watch_storage_is_busy(void) {
+    return false;
+}